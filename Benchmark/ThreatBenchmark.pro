@@ -0,0 +1,18 @@
+# Benchmark of the threat index against a brute-force rescan of the board, with a cross-check of both.
+# qmake Benchmark/ThreatBenchmark.pro && make && ./ThreatBenchmark
+TEMPLATE = app
+TARGET = ThreatBenchmark
+
+QT = core
+CONFIG += console c++11
+CONFIG -= app_bundle
+
+INCLUDEPATH += ..
+
+SOURCES += main.cpp \
+    threatbenchmark.cpp \
+    ../Engine/threatindex.cpp
+
+HEADERS += \
+    threatbenchmark.h \
+    ../Engine/threatindex.h
@@ -0,0 +1,26 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+
+#include "threatbenchmark.h"
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Benchmarks the threat index against a board rescan on 15x15 and 19x19 boards.");
+    parser.addHelpOption();
+    QCommandLineOption gamesOption("games", "Number of random games on each board.", "games", "100");
+    QCommandLineOption lineOption("line-length", "Winning line length.", "length", "5");
+    parser.addOptions({ gamesOption, lineOption });
+    parser.process(app);
+
+    bool matched = true;
+    for (int boardSize : { 15, 19 })
+    {
+        ThreatBenchmark benchmark(boardSize, parser.value(lineOption).toInt(), parser.value(gamesOption).toInt());
+        matched = benchmark.run() && matched;
+    }
+
+    return matched ? 0 : 1;
+}
@@ -0,0 +1,285 @@
+#include "threatbenchmark.h"
+
+#include <QElapsedTimer>
+#include <algorithm>
+
+namespace {
+
+const int KLineSteps[ThreatIndex::KNumberOfDirections][2] = {
+    { 1, 0 },   // HorizontalLine
+    { 0, 1 },   // VerticalLine
+    { 1, 1 },   // DownDiagonalLine
+    { -1, 1 }   // UpDiagonalLine
+};
+
+const int KNumberOfRunEnds = 3;
+
+/*!
+ * \brief threatLessThan Function orders runs by direction and first tile, which identify the run.
+ * \param left First run.
+ * \param right Second run.
+ * \return True if the first run goes before the second one.
+ */
+bool threatLessThan(const Threat& left, const Threat& right)
+{
+    if (left.direction != right.direction)
+    {
+        return left.direction < right.direction;
+    }
+
+    return left.startIndex < right.startIndex;
+}
+
+/*!
+ * \brief sameThreat Function compares all fields of two runs.
+ * \param left First run.
+ * \param right Second run.
+ * \return True if the runs are equal.
+ */
+bool sameThreat(const Threat& left, const Threat& right)
+{
+    return left.direction == right.direction && left.startIndex == right.startIndex && left.endIndex == right.endIndex
+            && left.length == right.length && left.player == right.player && left.ends == right.ends;
+}
+
+}
+
+ThreatBenchmark::ThreatBenchmark(int boardSize, int lineLength, int numberOfGames) :
+    m_boardSize(qMax(1, boardSize)),
+    m_lineLength(qBound(1, lineLength, qMax(1, boardSize))),
+    m_numberOfClasses(2 * m_lineLength * KNumberOfRunEnds)
+{
+    generateGames(qMax(1, numberOfGames));
+}
+
+bool ThreatBenchmark::run()
+{
+    qint64 indexChecksum = 0;
+    qint64 rescanChecksum = 0;
+    qint64 indexTime = timeIndex(indexChecksum);
+    qint64 rescanTime = timeRescan(rescanChecksum);
+    bool matched = indexChecksum == rescanChecksum && crossCheck();
+
+    double moves = static_cast<double>(m_games.size()) * m_boardSize * m_boardSize;
+    qInfo("%dx%d board, %d in a row, %d games: index %.1f ns/move, rescan %.1f ns/move, speedup %.1fx, cross-check %s",
+          m_boardSize, m_boardSize, m_lineLength, m_games.size(), indexTime / moves, rescanTime / moves,
+          indexTime > 0 ? static_cast<double>(rescanTime) / indexTime : 0.0, matched ? "passed" : "FAILED");
+
+    return matched;
+}
+
+void ThreatBenchmark::generateGames(int numberOfGames)
+{
+    int numberOfTiles = m_boardSize * m_boardSize;
+    quint32 random = 2463534242u;
+
+    m_games.resize(numberOfGames);
+    for (QVector<int>& game : m_games)
+    {
+        game.resize(numberOfTiles);
+        for (int tileIndex = 0; tileIndex < numberOfTiles; tileIndex++)
+        {
+            game[tileIndex] = tileIndex;
+        }
+
+        // Fisher-Yates shuffle with a xorshift generator, the same games on every run.
+        for (int tileIndex = numberOfTiles - 1; tileIndex > 0; tileIndex--)
+        {
+            random ^= random << 13;
+            random ^= random >> 17;
+            random ^= random << 5;
+            std::swap(game[tileIndex], game[static_cast<int>(random % static_cast<quint32>(tileIndex + 1))]);
+        }
+    }
+}
+
+qint64 ThreatBenchmark::timeIndex(qint64& checksum) const
+{
+    ThreatIndex index(m_boardSize, m_lineLength);
+    QElapsedTimer timer;
+    timer.start();
+
+    for (const QVector<int>& game : m_games)
+    {
+        index.clear();
+
+        for (int move = 0; move < game.size(); move++)
+        {
+            index.placeTile(game.at(move), move % 2 == 0 ? PlayerX : PlayerO);
+
+            for (int player = PlayerO; player <= PlayerX; player++)
+            {
+                for (int length = 1; length <= m_lineLength; length++)
+                {
+                    for (int ends = ClosedRun; ends <= OpenRun; ends++)
+                    {
+                        checksum += index.threatCount(static_cast<EPlayerType>(player), length, static_cast<ERunEnds>(ends));
+                    }
+                }
+            }
+        }
+    }
+
+    return timer.nsecsElapsed();
+}
+
+qint64 ThreatBenchmark::timeRescan(qint64& checksum) const
+{
+    QVector<int> tiles(m_boardSize * m_boardSize);
+    QVector<int> counts(m_numberOfClasses);
+    QElapsedTimer timer;
+    timer.start();
+
+    for (const QVector<int>& game : m_games)
+    {
+        tiles.fill(-1);
+
+        for (int move = 0; move < game.size(); move++)
+        {
+            tiles[game.at(move)] = move % 2 == 0 ? PlayerX : PlayerO;
+            rescan(tiles, counts, nullptr);
+
+            for (int count : counts)
+            {
+                checksum += count;
+            }
+        }
+    }
+
+    return timer.nsecsElapsed();
+}
+
+bool ThreatBenchmark::crossCheck() const
+{
+    ThreatIndex index(m_boardSize, m_lineLength);
+    QVector<int> tiles(m_boardSize * m_boardSize);
+    QVector<int> counts(m_numberOfClasses);
+    QVector<Threat> expectedRuns;
+    QVector<Threat> indexedRuns;
+
+    for (const QVector<int>& game : m_games)
+    {
+        index.clear();
+        tiles.fill(-1);
+
+        for (int move = 0; move < game.size(); move++)
+        {
+            EPlayerType player = move % 2 == 0 ? PlayerX : PlayerO;
+            index.placeTile(game.at(move), player);
+            tiles[game.at(move)] = player;
+
+            expectedRuns.clear();
+            rescan(tiles, counts, &expectedRuns);
+
+            // Every run listed in a class has to belong to it and the list length has to match the count.
+            indexedRuns.clear();
+            for (int owner = PlayerO; owner <= PlayerX; owner++)
+            {
+                for (int length = 1; length <= m_lineLength; length++)
+                {
+                    for (int ends = ClosedRun; ends <= OpenRun; ends++)
+                    {
+                        int listed = 0;
+                        for (int handle = index.firstThreat(static_cast<EPlayerType>(owner), length, static_cast<ERunEnds>(ends));
+                             handle != ThreatIndex::KNoThreat; handle = index.nextThreat(handle))
+                        {
+                            Threat threat = index.threat(handle);
+                            if (classIndex(threat.player, threat.length, threat.ends) != classIndex(owner, length, ends))
+                            {
+                                return false;
+                            }
+
+                            indexedRuns.append(threat);
+                            listed++;
+                        }
+
+                        int expected = counts.at(classIndex(owner, length, ends));
+                        if (listed != expected
+                                || index.threatCount(static_cast<EPlayerType>(owner), length, static_cast<ERunEnds>(ends)) != expected)
+                        {
+                            return false;
+                        }
+                    }
+                }
+            }
+
+            std::sort(indexedRuns.begin(), indexedRuns.end(), threatLessThan);
+            if (indexedRuns.size() != expectedRuns.size()
+                    || !std::equal(indexedRuns.constBegin(), indexedRuns.constEnd(), expectedRuns.constBegin(), sameThreat))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+void ThreatBenchmark::rescan(const QVector<int>& tiles, QVector<int>& counts, QVector<Threat>* runs) const
+{
+    counts.fill(0);
+
+    // Runs are reported in the order of direction and first tile, the same order threatLessThan sorts in.
+    for (int direction = 0; direction < ThreatIndex::KNumberOfDirections; direction++)
+    {
+        int dx = KLineSteps[direction][0];
+        int dy = KLineSteps[direction][1];
+
+        for (int y = 0; y < m_boardSize; y++)
+        {
+            for (int x = 0; x < m_boardSize; x++)
+            {
+                int player = tiles.at(y * m_boardSize + x);
+                if (player == -1)
+                {
+                    continue;
+                }
+
+                // Only the first tile of the run starts the walk.
+                int beforeX = x - dx;
+                int beforeY = y - dy;
+                bool beforeOnBoard = beforeX >= 0 && beforeX < m_boardSize && beforeY >= 0 && beforeY < m_boardSize;
+                if (beforeOnBoard && tiles.at(beforeY * m_boardSize + beforeX) == player)
+                {
+                    continue;
+                }
+
+                int length = 1;
+                int endX = x;
+                int endY = y;
+                while (endX + dx >= 0 && endX + dx < m_boardSize && endY + dy < m_boardSize
+                       && tiles.at((endY + dy) * m_boardSize + endX + dx) == player)
+                {
+                    endX += dx;
+                    endY += dy;
+                    length++;
+                }
+
+                int afterX = endX + dx;
+                int afterY = endY + dy;
+                bool afterOnBoard = afterX >= 0 && afterX < m_boardSize && afterY < m_boardSize;
+                int ends = (beforeOnBoard && tiles.at(beforeY * m_boardSize + beforeX) == -1 ? 1 : 0)
+                        + (afterOnBoard && tiles.at(afterY * m_boardSize + afterX) == -1 ? 1 : 0);
+
+                counts[classIndex(player, length, ends)]++;
+
+                if (runs)
+                {
+                    Threat threat;
+                    threat.direction = static_cast<ELineType>(direction);
+                    threat.startIndex = y * m_boardSize + x;
+                    threat.endIndex = endY * m_boardSize + endX;
+                    threat.length = length;
+                    threat.player = static_cast<EPlayerType>(player);
+                    threat.ends = static_cast<ERunEnds>(ends);
+                    runs->append(threat);
+                }
+            }
+        }
+    }
+}
+
+int ThreatBenchmark::classIndex(int player, int length, int ends) const
+{
+    return (player * m_lineLength + qMin(length, m_lineLength) - 1) * KNumberOfRunEnds + ends;
+}
@@ -0,0 +1,82 @@
+#ifndef THREATBENCHMARK_H
+#define THREATBENCHMARK_H
+
+#include <QVector>
+
+#include "Engine/threatindex.h"
+
+/*!
+ * \brief The ThreatBenchmark class Measures ThreatIndex against a brute-force rescan of the board and cross-checks both.
+ *
+ * Every game fills the whole board in random order. After each move the index is updated and all of its classes
+ * are queried, which is compared with rescanning the board for runs after each move, the work the index replaces.
+ * Afterwards the games are replayed and counts and lists of every class are compared with the rescan after each move.
+ */
+class ThreatBenchmark
+{
+public:
+    /*!
+     * \brief ThreatBenchmark Constructor.
+     * \param boardSize Number of tiles in a row of the board.
+     * \param lineLength Number of tiles of the same type in a row needed to win.
+     * \param numberOfGames Number of random games.
+     */
+    ThreatBenchmark(int boardSize, int lineLength, int numberOfGames);
+
+    /*!
+     * \brief run Method times both approaches, cross-checks them and prints the results.
+     * \return True if the index matched the rescan after every move, False otherwise.
+     */
+    bool run();
+
+private:
+    int m_boardSize; /*!< Number of tiles in a row. */
+    int m_lineLength; /*!< Winning line length. */
+    int m_numberOfClasses; /*!< Number of threat classes (owner, capped length, open ends). */
+    QVector<QVector<int>> m_games; /*!< Order of the moves of each game. */
+
+    /*!
+     * \brief generateGames Method creates random move orders.
+     * \param numberOfGames Number of games.
+     */
+    void generateGames(int numberOfGames);
+
+    /*!
+     * \brief timeIndex Method plays all games through the index and queries every class after each move.
+     * \param checksum Sum of the queried counts, keeps the queries from being optimized out.
+     * \return Elapsed time in nanoseconds.
+     */
+    qint64 timeIndex(qint64& checksum) const;
+
+    /*!
+     * \brief timeRescan Method plays all games and rescans the board after each move.
+     * \param checksum Sum of the counts found, equal to the one of timeIndex.
+     * \return Elapsed time in nanoseconds.
+     */
+    qint64 timeRescan(qint64& checksum) const;
+
+    /*!
+     * \brief crossCheck Method replays all games and compares the index with the rescan after each move.
+     * \return True if counts and lists of every class matched, False otherwise.
+     */
+    bool crossCheck() const;
+
+    /*!
+     * \brief rescan Method finds all maximal runs on the board by walking every line.
+     * \param tiles Owner of each tile, -1 for empty tiles.
+     * \param counts Number of runs of each class, filled by the method.
+     * \param runs Runs found, filled by the method if not nullptr.
+     */
+    void rescan(const QVector<int>& tiles, QVector<int>& counts, QVector<Threat>* runs) const;
+
+    /*!
+     * \brief classIndex Method returns index of the class of runs.
+     * \param player Owner of the runs.
+     * \param length Length of the runs.
+     * \param ends Number of open ends.
+     * \return Class index.
+     */
+    int classIndex(int player, int length, int ends) const;
+};
+
+#endif // THREATBENCHMARK_H
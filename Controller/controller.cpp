@@ -1,18 +1,66 @@
 #include "controller.h"
 
-Controller::Controller(Engine &engine, QObject *parent) : QObject(parent), m_engine(engine)
+#include <QTimer>
+
+#include "Engine/boardgeometry.h"
+#include "Engine/moveanalyzer.h"
+
+Controller::Controller(GameEngine &engine, QObject *parent) :
+    QObject(parent),
+    m_engine(engine),
+    m_analyzer(nullptr),
+    m_analysisEnabled(false),
+    m_analysisScheduled(false),
+    m_analysisRequest(0),
+    m_analysisPlayer(-1),
+    m_evaluatedPlayer(-1)
 {
-    QObject::connect(&engine, &Engine::tileStateChanged, this, &Controller::tileStateChanged);
-    QObject::connect(&engine, &Engine::currentPlayerChanged, this, &Controller::currentPlayerChanged);
-    QObject::connect(&engine, &Engine::roundStatusChanged, this, &Controller::roundStatusChanged);
-    QObject::connect(&engine, &Engine::lineCompleted, this, &Controller::lineCompleted);
-    QObject::connect(&engine, &Engine::drawsNumberChanged, this, &Controller::drawsNumberChanged);
-    QObject::connect(&engine, &Engine::winsNumberChanged, this, &Controller::winsNumberChanged);
+    QObject::connect(&engine, &GameEngine::tileStateChanged, this, &Controller::tileStateChanged);
+    QObject::connect(&engine, &GameEngine::currentPlayerChanged, this, &Controller::currentPlayerChanged);
+    QObject::connect(&engine, &GameEngine::roundStatusChanged, this, &Controller::roundStatusChanged);
+    QObject::connect(&engine, &GameEngine::lineCompleted, this, &Controller::lineCompleted);
+    QObject::connect(&engine, &GameEngine::drawsNumberChanged, this, &Controller::drawsNumberChanged);
+    QObject::connect(&engine, &GameEngine::winsNumberChanged, this, &Controller::winsNumberChanged);
+    QObject::connect(&engine, &GameEngine::tileStateChanged, this, &Controller::positionEvaluationChanged);
+    QObject::connect(&engine, &GameEngine::currentPlayerChanged, this, &Controller::positionEvaluationChanged);
+    QObject::connect(&engine, &GameEngine::roundStatusChanged, this, &Controller::positionEvaluationChanged);
+
+    int tilesNumber = engine.getBoardSize() * engine.getBoardSize();
+    m_moveValues.fill(UnknownPosition, tilesNumber);
+    m_moveDistances.fill(0, tilesNumber);
+
+    // Exact analysis is available only for boards small enough to be solved while playing.
+    if (engine.getBoardSize() <= BoardGeometry::KMaxBoardSize)
+    {
+        qRegisterMetaType<QVector<int>>("QVector<int>");
+
+        m_analyzer = new MoveAnalyzer(engine.getBoardSize(), engine.getBoardSize());
+        m_analyzer->moveToThread(&m_analysisThread);
+        QObject::connect(&m_analysisThread, &QThread::finished, m_analyzer, &QObject::deleteLater);
+        QObject::connect(m_analyzer, &MoveAnalyzer::analysisFinished, this, &Controller::onAnalysisFinished);
+
+        QObject::connect(&engine, &GameEngine::tileStateChanged, this, &Controller::scheduleMoveAnalysis);
+        QObject::connect(&engine, &GameEngine::roundStatusChanged, this, &Controller::scheduleMoveAnalysis);
+        QObject::connect(&engine, &GameEngine::currentPlayerChanged, this, &Controller::scheduleMoveAnalysis);
+
+        m_analysisThread.start(QThread::LowPriority);
+    }
+}
+
+Controller::~Controller()
+{
+    if (m_analyzer)
+    {
+        m_analyzer->setLatestRequest(-1);
+    }
+
+    m_analysisThread.quit();
+    m_analysisThread.wait();
 }
 
 int Controller::boardSize() const
 {
-    return Engine::KBoardSize;
+    return m_engine.getBoardSize();
 }
 
 int Controller::currentPlayer() const
@@ -35,6 +83,21 @@ int Controller::winsNumber() const
     return m_engine.getWinsNumberForCurrentPlayer();
 }
 
+int Controller::positionValue() const
+{
+    return m_engine.getPositionValue();
+}
+
+int Controller::positionDistance() const
+{
+    return m_engine.getPositionDistance();
+}
+
+int Controller::bestMove() const
+{
+    return m_engine.getBestMove();
+}
+
 void Controller::updateTileState(int index)
 {
     m_engine.updateTileState(index);
@@ -45,7 +108,168 @@ int Controller::getTileType(int index) const
     return m_engine.getTileType(index);
 }
 
+bool Controller::isTilePlayable(int index) const
+{
+    return m_engine.isTilePlayable(index);
+}
+
 void Controller::startNextRound()
 {
     m_engine.startNextRound();
 }
+
+int Controller::getMoveValue(int index) const
+{
+    // Evaluations may lag behind the position, they are reported only for the player they have been computed for
+    // and never for tiles occupied since then.
+    if (m_evaluatedPlayer != m_engine.getCurrentPlayer() || !m_engine.isTilePlayable(index))
+    {
+        return UnknownPosition;
+    }
+
+    return m_moveValues.value(index, UnknownPosition);
+}
+
+int Controller::getMoveDistance(int index) const
+{
+    if (m_evaluatedPlayer != m_engine.getCurrentPlayer() || !m_engine.isTilePlayable(index))
+    {
+        return 0;
+    }
+
+    return m_moveDistances.value(index, 0);
+}
+
+bool Controller::loadTablebase(const QString& filePath)
+{
+    if (!m_engine.loadTablebase(filePath))
+    {
+        return false;
+    }
+
+    // The analyzer maps the file on its own, so the engine and the analysis thread never share the mapping.
+    if (m_analyzer)
+    {
+        QMetaObject::invokeMethod(m_analyzer, "openTablebase", Qt::QueuedConnection, Q_ARG(QString, filePath));
+        scheduleMoveAnalysis();
+    }
+
+    emit positionEvaluationChanged();
+
+    return true;
+}
+
+bool Controller::analysisEnabled() const
+{
+    return m_analysisEnabled;
+}
+
+void Controller::setAnalysisEnabled(bool enabled)
+{
+    if (m_analysisEnabled == enabled)
+    {
+        return;
+    }
+
+    m_analysisEnabled = enabled;
+    emit analysisEnabledChanged();
+
+    if (m_analysisEnabled)
+    {
+        scheduleMoveAnalysis();
+    }
+    else
+    {
+        // Results of the pending request are dropped and the overlay is cleared once.
+        m_analysisRequest++;
+        if (m_analyzer)
+        {
+            m_analyzer->setLatestRequest(m_analysisRequest);
+        }
+
+        clearMoveEvaluations();
+    }
+}
+
+void Controller::scheduleMoveAnalysis()
+{
+    if (!m_analyzer || !m_analysisEnabled || m_analysisScheduled)
+    {
+        return;
+    }
+
+    m_analysisScheduled = true;
+    QTimer::singleShot(0, this, &Controller::startMoveAnalysis);
+}
+
+void Controller::startMoveAnalysis()
+{
+    m_analysisScheduled = false;
+
+    if (!m_analysisEnabled)
+    {
+        return;
+    }
+
+    m_analysisRequest++;
+    m_analyzer->setLatestRequest(m_analysisRequest);
+
+    if (m_engine.getRoundStatus() != ERoundStatus::NotFinished)
+    {
+        clearMoveEvaluations();
+        return;
+    }
+
+    // Evaluations of the previous position stay on screen until the results of this request arrive, but only if they
+    // have been computed for the same player. Otherwise they would show the opponent's outcomes, so they are hidden.
+    m_analysisPlayer = m_engine.getCurrentPlayer();
+    if (m_analysisPlayer != m_evaluatedPlayer)
+    {
+        clearMoveEvaluations();
+    }
+
+    uint moverMask = 0;
+    uint opponentMask = 0;
+    int currentTile = m_engine.getCurrentPlayer() == PlayerX ? Cross : Nought;
+
+    for (int tileIndex = 0; tileIndex < m_moveValues.size(); tileIndex++)
+    {
+        int tileType = m_engine.getTileType(tileIndex);
+        if (tileType == currentTile)
+        {
+            moverMask |= 1u << tileIndex;
+        }
+        else if (tileType != Empty)
+        {
+            opponentMask |= 1u << tileIndex;
+        }
+    }
+
+    QMetaObject::invokeMethod(m_analyzer, "analyze", Qt::QueuedConnection,
+                              Q_ARG(int, m_analysisRequest), Q_ARG(uint, moverMask), Q_ARG(uint, opponentMask));
+}
+
+void Controller::onAnalysisFinished(int requestId, QVector<int> values, QVector<int> distances)
+{
+    if (requestId != m_analysisRequest)
+    {
+        return;
+    }
+
+    m_moveValues = values;
+    m_moveDistances = distances;
+    m_evaluatedPlayer = m_analysisPlayer;
+    emit moveEvaluationsChanged();
+}
+
+void Controller::clearMoveEvaluations()
+{
+    if (!m_moveValues.contains(WinningPosition) && !m_moveValues.contains(DrawnPosition) && !m_moveValues.contains(LosingPosition))
+    {
+        return;
+    }
+
+    m_moveValues.fill(UnknownPosition);
+    m_moveDistances.fill(0);
+    emit moveEvaluationsChanged();
+}
@@ -3,8 +3,12 @@
 
 #include <QObject>
 #include <QStringList>
+#include <QThread>
+#include <QVector>
 
-#include "Engine/engine.h"
+#include "Engine/gameengine.h"
+
+class MoveAnalyzer;
 
 
 /*!
@@ -18,6 +22,10 @@ class Controller : public QObject
     Q_PROPERTY(int roundStatus READ roundStatus NOTIFY roundStatusChanged)
     Q_PROPERTY(int drawsNumber READ drawsNumber NOTIFY drawsNumberChanged)
     Q_PROPERTY(int winsNumber READ winsNumber NOTIFY winsNumberChanged)
+    Q_PROPERTY(bool analysisEnabled READ analysisEnabled WRITE setAnalysisEnabled NOTIFY analysisEnabledChanged)
+    Q_PROPERTY(int positionValue READ positionValue NOTIFY positionEvaluationChanged)
+    Q_PROPERTY(int positionDistance READ positionDistance NOTIFY positionEvaluationChanged)
+    Q_PROPERTY(int bestMove READ bestMove NOTIFY positionEvaluationChanged)
 
 signals:
     /*!
@@ -53,13 +61,33 @@ signals:
      */
     void winsNumberChanged();
 
+    /*!
+     * \brief analysisEnabledChanged Signal emitted when the move analysis has been enabled or disabled.
+     */
+    void analysisEnabledChanged();
+
+    /*!
+     * \brief positionEvaluationChanged Signal emitted when the tablebase evaluation of the current position may have changed.
+     */
+    void positionEvaluationChanged();
+
+    /*!
+     * \brief moveEvaluationsChanged Signal emitted when evaluations of the empty tiles have been updated.
+     */
+    void moveEvaluationsChanged();
+
 public:
     /*!
      * \brief Controller
      * \param engine Game engine.
      * \param parent Parent QObject instance.
      */
-    Controller(Engine& engine, QObject* parent = nullptr);
+    Controller(GameEngine& engine, QObject* parent = nullptr);
+
+    /*!
+     * \brief ~Controller Destructor stopping the analysis thread.
+     */
+    ~Controller();
 
     /*!
      * \brief boardSize Getter method returning game board size.
@@ -80,13 +108,87 @@ public:
      */
     Q_INVOKABLE int getTileType(int index) const;
 
+    /*!
+     * \brief isTilePlayable Method checks if the current player can place the tile.
+     * \param index Index of the tile to be checked.
+     * \return True if the tile can be updated, False otherwise.
+     */
+    Q_INVOKABLE bool isTilePlayable(int index) const;
+
     /*!
      * \brief startNextRound Method for starting the next round in the game engine.
      */
     Q_INVOKABLE void startNextRound();
 
+    /*!
+     * \brief getMoveValue Method returns evaluated outcome for the current player moving to the tile.
+     * \param index Index of the tile.
+     * \return Outcome (EPositionValue), UnknownPosition for tiles which can not be played or if the evaluation of the current player is not available yet.
+     */
+    Q_INVOKABLE int getMoveValue(int index) const;
+
+    /*!
+     * \brief getMoveDistance Method returns number of moves until the end of the round after moving to the tile, counting the move itself.
+     * \param index Index of the tile.
+     * \return Number of moves, 0 if the evaluation is not available.
+     */
+    Q_INVOKABLE int getMoveDistance(int index) const;
+
+    /*!
+     * \brief loadTablebase Method loads the tablebase into the game engine and the move analyzer.
+     * \param filePath Path to the tablebase file.
+     * \return True if the engine has accepted the tablebase, False otherwise.
+     */
+    bool loadTablebase(const QString& filePath);
+
+    /*!
+     * \brief analysisEnabled Getter method returning if the move analysis is enabled.
+     * \return True if the analysis is enabled, False otherwise.
+     */
+    bool analysisEnabled() const;
+
+    /*!
+     * \brief setAnalysisEnabled Method enables or disables evaluation of the empty tiles after each move.
+     * \param enabled True to enable the analysis.
+     */
+    void setAnalysisEnabled(bool enabled);
+
+private slots:
+    /*!
+     * \brief scheduleMoveAnalysis Method schedules the analysis once the engine has finished processing the current change.
+     * Several changes of a single move are coalesced into one analysis request.
+     */
+    void scheduleMoveAnalysis();
+
+    /*!
+     * \brief startMoveAnalysis Method sends the current position to the analysis thread.
+     */
+    void startMoveAnalysis();
+
+    /*!
+     * \brief onAnalysisFinished Method stores evaluations of the newest request.
+     * \param requestId Identifier of the request.
+     * \param values Outcome for each tile.
+     * \param distances Distance for each tile.
+     */
+    void onAnalysisFinished(int requestId, QVector<int> values, QVector<int> distances);
+
 private:
-    Engine& m_engine; /*!< Reference to game engine. */
+    GameEngine& m_engine; /*!< Reference to game engine. */
+    QThread m_analysisThread; /*!< Thread running the move analyzer. */
+    MoveAnalyzer* m_analyzer; /*!< Move analyzer living in the analysis thread, nullptr if the board is too large to be analyzed. */
+    bool m_analysisEnabled; /*!< True if the analysis is enabled. */
+    bool m_analysisScheduled; /*!< True if the analysis has been scheduled but not started yet. */
+    int m_analysisRequest; /*!< Identifier of the newest analysis request. */
+    int m_analysisPlayer; /*!< Player to move in the position of the newest analysis request. */
+    int m_evaluatedPlayer; /*!< Player the stored evaluations have been computed for, -1 if there are none. */
+    QVector<int> m_moveValues; /*!< Outcome of moving to each tile. */
+    QVector<int> m_moveDistances; /*!< Distance of moving to each tile. */
+
+    /*!
+     * \brief clearMoveEvaluations Method removes all evaluations, notifying the view only if there were any.
+     */
+    void clearMoveEvaluations();
 
     /*!
      * \brief currentPlayer Method for retrieving current player from game engine.
@@ -106,6 +208,24 @@ private:
      */
     int drawsNumber() const;
 
+    /*!
+     * \brief positionValue Method for retrieving tablebase value of the current position for the current player.
+     * \return Position value (EPositionValue), UnknownPosition if there is no tablebase loaded.
+     */
+    int positionValue() const;
+
+    /*!
+     * \brief positionDistance Method for retrieving number of moves until the end of the round with perfect play.
+     * \return Number of moves, 0 if it is unknown.
+     */
+    int positionDistance() const;
+
+    /*!
+     * \brief bestMove Method for retrieving tablebase best move of the current player.
+     * \return Tile index, -1 if it is unknown.
+     */
+    int bestMove() const;
+
     /*!
      * \brief winsNumber Method for retrieving current number of wins for current player from game engine.
      * \return Number of wins for current player.
@@ -0,0 +1,110 @@
+#include "spectatorfeed.h"
+
+#include <QElapsedTimer>
+#include <QVector>
+#include <QtAlgorithms>
+
+#include "Engine/engine.h"
+
+namespace {
+
+/*!
+ * \brief playRandomMove Function plays a random playable tile, or starts the next round if the round has finished.
+ * \param engine Engine of the game.
+ * \param random Random number selecting the tile.
+ */
+void playRandomMove(Engine& engine, quint32 random)
+{
+    if (engine.getRoundStatus() != ERoundStatus::NotFinished)
+    {
+        engine.startNextRound();
+        return;
+    }
+
+    int playableTiles[Engine::KNumberOfTiles];
+    int playableTilesNumber = 0;
+    for (int tileIndex = 0; tileIndex < Engine::KNumberOfTiles; tileIndex++)
+    {
+        if (engine.isTilePlayable(tileIndex))
+        {
+            playableTiles[playableTilesNumber++] = tileIndex;
+        }
+    }
+
+    engine.updateTileState(playableTiles[random % static_cast<quint32>(playableTilesNumber)]);
+}
+
+}
+
+SpectatorFeed::SpectatorFeed(SpectatorModel &model, int boardsNumber, int movesPerSecond, QObject *parent) :
+    QThread(parent),
+    m_model(model),
+    m_boardsNumber(qMax(0, boardsNumber)),
+    m_movesPerSecond(qMax(0, movesPerSecond))
+{
+}
+
+SpectatorFeed::~SpectatorFeed()
+{
+    requestInterruption();
+    wait();
+}
+
+void SpectatorFeed::run()
+{
+    // Engines are created here, so they belong to the feed thread.
+    QVector<Engine*> engines;
+    for (int board = 0; board < m_boardsNumber; board++)
+    {
+        engines.append(new Engine());
+    }
+
+    quint32 random = 2463534242u;
+    QElapsedTimer timer;
+    timer.start();
+    qint64 moves = 0;
+
+    while (!isInterruptionRequested())
+    {
+        for (int board = 0; board < engines.size(); board++)
+        {
+            // Xorshift generator, enough to vary the games.
+            random ^= random << 13;
+            random ^= random >> 17;
+            random ^= random << 5;
+
+            Engine& engine = *engines.at(board);
+            playRandomMove(engine, random);
+
+            quint32 crossMask = 0;
+            quint32 noughtMask = 0;
+            for (int tileIndex = 0; tileIndex < Engine::KNumberOfTiles; tileIndex++)
+            {
+                int tileType = engine.getTileType(tileIndex);
+                if (tileType == ETileState::Cross)
+                {
+                    crossMask |= 1u << tileIndex;
+                }
+                else if (tileType == ETileState::Nought)
+                {
+                    noughtMask |= 1u << tileIndex;
+                }
+            }
+
+            m_model.publishBoard(board, crossMask, noughtMask, engine.getCurrentPlayer(), engine.getRoundStatus());
+        }
+
+        if (m_movesPerSecond > 0)
+        {
+            // Keep the rate regardless of the time spent on the moves.
+            moves++;
+            qint64 delay = moves * 1000 / m_movesPerSecond - timer.elapsed();
+            if (delay > 0)
+            {
+                msleep(static_cast<unsigned long>(delay));
+            }
+        }
+    }
+
+    qDeleteAll(engines);
+}
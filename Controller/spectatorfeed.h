@@ -0,0 +1,47 @@
+#ifndef SPECTATORFEED_H
+#define SPECTATORFEED_H
+
+#include <QThread>
+
+#include "spectatormodel.h"
+
+/*!
+ * \brief The SpectatorFeed class Background thread running an Engine for every board of the SpectatorModel.
+ *
+ * Each engine is played with random moves through the same updateTileState and startNextRound calls as the game view
+ * uses, so the spectated games follow exactly the rules of the Engine. Each game publishes its board after every move.
+ * The feed never waits for the view, so the games may progress much faster than the display refresh rate;
+ * the model keeps only the latest state of each board.
+ */
+class SpectatorFeed : public QThread
+{
+    Q_OBJECT
+
+public:
+    /*!
+     * \brief SpectatorFeed Constructor.
+     * \param model Model receiving the boards.
+     * \param boardsNumber Number of games.
+     * \param movesPerSecond Number of moves per second of each game, 0 for no limit.
+     * \param parent Parent QObject.
+     */
+    SpectatorFeed(SpectatorModel& model, int boardsNumber, int movesPerSecond, QObject* parent = nullptr);
+
+    /*!
+     * \brief ~SpectatorFeed Destructor stopping the thread.
+     */
+    ~SpectatorFeed();
+
+protected:
+    /*!
+     * \brief run Method creates the engines and plays the games until interruption is requested.
+     */
+    void run() override;
+
+private:
+    SpectatorModel& m_model; /*!< Model receiving the boards. */
+    int m_boardsNumber; /*!< Number of games. */
+    int m_movesPerSecond; /*!< Number of moves per second of each game, 0 for no limit. */
+};
+
+#endif // SPECTATORFEED_H
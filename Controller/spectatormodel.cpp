@@ -0,0 +1,198 @@
+#include "spectatormodel.h"
+
+namespace {
+
+const int KMaskBits = 16; // Number of bits of each tile mask in the packed state.
+const int KCurrentPlayerShift = 2 * KMaskBits; // Position of the current player in the packed state.
+const int KRoundStatusShift = KCurrentPlayerShift + 1; // Position of the round status in the packed state.
+
+}
+
+const int SpectatorModel::KMaxBoardSize;
+
+SpectatorModel::SpectatorModel(int boardsNumber, int boardSize, QObject *parent) :
+    QAbstractListModel(parent),
+    m_boardsNumber(qMax(0, boardsNumber)),
+    m_boardSize(qBound(1, boardSize, KMaxBoardSize)),
+    m_publishedBoards(new PublishedBoard[qMax(0, boardsNumber)]),
+    m_displayedBoards(qMax(0, boardsNumber)),
+    m_frameRequested(0)
+{
+    QVariantList emptyTiles;
+    for (int tileIndex = 0; tileIndex < m_boardSize * m_boardSize; tileIndex++)
+    {
+        emptyTiles.append(static_cast<int>(ETileState::Empty));
+    }
+
+    quint64 emptyState = packState(0, 0, PlayerX, NotFinished);
+    for (int board = 0; board < m_boardsNumber; board++)
+    {
+        m_publishedBoards[board].state.storeRelease(emptyState);
+        m_displayedBoards[board].tiles = emptyTiles;
+        m_displayedBoards[board].state = emptyState;
+    }
+}
+
+int SpectatorModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_boardsNumber;
+}
+
+QVariant SpectatorModel::data(const QModelIndex &index, int role) const
+{
+    if (!index.isValid() || index.row() >= m_boardsNumber)
+    {
+        return QVariant();
+    }
+
+    const DisplayedBoard& board = m_displayedBoards.at(index.row());
+
+    switch (role)
+    {
+    case TilesRole:
+        return board.tiles;
+    case BoardSizeRole:
+        return m_boardSize;
+    case CurrentPlayerRole:
+        return board.currentPlayer;
+    case RoundStatusRole:
+        return board.roundStatus;
+    default:
+        return QVariant();
+    }
+}
+
+QHash<int, QByteArray> SpectatorModel::roleNames() const
+{
+    QHash<int, QByteArray> roles;
+    roles.insert(TilesRole, "tiles");
+    roles.insert(BoardSizeRole, "boardSize");
+    roles.insert(CurrentPlayerRole, "currentPlayer");
+    roles.insert(RoundStatusRole, "roundStatus");
+
+    return roles;
+}
+
+void SpectatorModel::setWindow(QQuickWindow *window)
+{
+    if (m_window)
+    {
+        QObject::disconnect(m_window, &QQuickWindow::afterAnimating, this, &SpectatorModel::flush);
+    }
+
+    m_window = window;
+
+    if (m_window)
+    {
+        QObject::connect(m_window, &QQuickWindow::afterAnimating, this, &SpectatorModel::flush);
+        m_window->update();
+    }
+}
+
+void SpectatorModel::publishBoard(int board, quint32 crossMask, quint32 noughtMask, int currentPlayer, int roundStatus)
+{
+    if (board < 0 || board >= m_boardsNumber)
+    {
+        return;
+    }
+
+    PublishedBoard& publishedBoard = m_publishedBoards[board];
+    publishedBoard.state.storeRelease(packState(crossMask, noughtMask, currentPlayer, roundStatus));
+
+    // Only the first change of a visible board between two frames asks for the next frame.
+    if (publishedBoard.visible.loadAcquire() && m_frameRequested.testAndSetOrdered(0, 1))
+    {
+        QMetaObject::invokeMethod(this, "requestFrame", Qt::QueuedConnection);
+    }
+}
+
+void SpectatorModel::setBoardVisible(int board, bool visible)
+{
+    if (board < 0 || board >= m_boardsNumber)
+    {
+        return;
+    }
+
+    m_publishedBoards[board].visible.storeRelease(visible ? 1 : 0);
+
+    if (visible)
+    {
+        m_visibleBoards.insert(board);
+
+        // The board may have changed a lot while it was culled, show its latest state right away.
+        if (updateDisplayedBoard(board))
+        {
+            QModelIndex modelIndex = index(board);
+            emit dataChanged(modelIndex, modelIndex);
+        }
+    }
+    else
+    {
+        m_visibleBoards.remove(board);
+    }
+}
+
+void SpectatorModel::requestFrame()
+{
+    if (m_window)
+    {
+        m_window->update();
+    }
+}
+
+void SpectatorModel::flush()
+{
+    m_frameRequested.storeRelease(0);
+
+    for (int board : m_visibleBoards)
+    {
+        if (updateDisplayedBoard(board))
+        {
+            QModelIndex modelIndex = index(board);
+            emit dataChanged(modelIndex, modelIndex, { TilesRole, CurrentPlayerRole, RoundStatusRole });
+        }
+    }
+}
+
+quint64 SpectatorModel::packState(quint32 crossMask, quint32 noughtMask, int currentPlayer, int roundStatus)
+{
+    quint64 tileMask = (Q_UINT64_C(1) << KMaskBits) - 1;
+
+    return (crossMask & tileMask)
+            | ((noughtMask & tileMask) << KMaskBits)
+            | (static_cast<quint64>(currentPlayer & 0x1) << KCurrentPlayerShift)
+            | (static_cast<quint64>(roundStatus & 0x3) << KRoundStatusShift);
+}
+
+bool SpectatorModel::updateDisplayedBoard(int board)
+{
+    quint64 state = m_publishedBoards[board].state.loadAcquire();
+    DisplayedBoard& displayedBoard = m_displayedBoards[board];
+
+    if (state == displayedBoard.state)
+    {
+        return false;
+    }
+
+    displayedBoard.state = state;
+    displayedBoard.currentPlayer = static_cast<int>((state >> KCurrentPlayerShift) & 0x1);
+    displayedBoard.roundStatus = static_cast<int>((state >> KRoundStatusShift) & 0x3);
+
+    // Tiles are expanded only here, once per frame for visible boards.
+    for (int tileIndex = 0; tileIndex < m_boardSize * m_boardSize; tileIndex++)
+    {
+        int tileState = ETileState::Empty;
+        if (state & (Q_UINT64_C(1) << tileIndex))
+        {
+            tileState = ETileState::Cross;
+        }
+        else if (state & (Q_UINT64_C(1) << (KMaskBits + tileIndex)))
+        {
+            tileState = ETileState::Nought;
+        }
+
+        displayedBoard.tiles[tileIndex] = tileState;
+    }
+
+    return true;
+}
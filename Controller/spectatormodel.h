@@ -0,0 +1,155 @@
+#ifndef SPECTATORMODEL_H
+#define SPECTATORMODEL_H
+
+#include <QAbstractListModel>
+#include <QAtomicInt>
+#include <QAtomicInteger>
+#include <QPointer>
+#include <QQuickWindow>
+#include <QScopedArrayPointer>
+#include <QSet>
+#include <QVariantList>
+#include <QVector>
+
+#include "Engine/gameengine.h"
+
+/*!
+ * \brief The SpectatorModel class List model of live game boards shown by the spectator view.
+ *
+ * Game sources publish their boards from any thread with publishBoard at any rate. Publishing stores the tile masks,
+ * current player and round status packed in a single atomic word, without locks or allocations; the model expands
+ * the word into tiles only when it copies the board to the view once per frame (on QQuickWindow::afterAnimating),
+ * and only for boards which have changed and are currently visible. Boards are reported visible by their delegates,
+ * so boards culled by the view cost nothing besides publishing and always have their latest state ready.
+ * A frame is requested only when a visible board has changed, so the view work scales with the number of visible
+ * changes and not with the games throughput.
+ */
+class SpectatorModel : public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    static const int KMaxBoardSize = 4; /*!< Largest board whose tile masks fit into the published state. */
+
+    /*!
+     * \brief The ERoles enum Model roles available in the delegates.
+     */
+    enum ERoles {
+        TilesRole = Qt::UserRole + 1,
+        BoardSizeRole,
+        CurrentPlayerRole,
+        RoundStatusRole
+    };
+
+    /*!
+     * \brief SpectatorModel Constructor.
+     * \param boardsNumber Number of boards.
+     * \param boardSize Number of tiles in a row of each board, up to KMaxBoardSize.
+     * \param parent Parent QObject.
+     */
+    SpectatorModel(int boardsNumber, int boardSize, QObject* parent = nullptr);
+
+    /*!
+     * \brief rowCount Method returns number of boards.
+     * \param parent Parent index, unused.
+     * \return Number of boards.
+     */
+    int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+    /*!
+     * \brief data Method returns the board data displayed by the view.
+     * \param index Index of the board.
+     * \param role One of ERoles.
+     * \return Board data.
+     */
+    QVariant data(const QModelIndex& index, int role) const override;
+
+    /*!
+     * \brief roleNames Method returns names of the roles used in QML.
+     * \return Role names.
+     */
+    QHash<int, QByteArray> roleNames() const override;
+
+    /*!
+     * \brief setWindow Method sets the window which frames pace the updates of the model.
+     * \param window Window showing the boards.
+     */
+    void setWindow(QQuickWindow* window);
+
+    /*!
+     * \brief publishBoard Method stores the latest state of the board. Thread safe and lock free.
+     * \param board Index of the board.
+     * \param crossMask Bit mask of the tiles with crosses.
+     * \param noughtMask Bit mask of the tiles with noughts.
+     * \param currentPlayer Current player of the board.
+     * \param roundStatus Round status of the board.
+     */
+    void publishBoard(int board, quint32 crossMask, quint32 noughtMask, int currentPlayer, int roundStatus);
+
+    /*!
+     * \brief setBoardVisible Method is called by the delegates when they are created or destroyed by the view.
+     * \param board Index of the board.
+     * \param visible True if the board has a delegate, False otherwise.
+     */
+    Q_INVOKABLE void setBoardVisible(int board, bool visible);
+
+private slots:
+    /*!
+     * \brief requestFrame Method schedules the next frame of the window.
+     */
+    void requestFrame();
+
+    /*!
+     * \brief flush Method copies changed visible boards to the view. Called once per frame.
+     */
+    void flush();
+
+private:
+    /*!
+     * \brief The PublishedBoard struct Latest state of the board written by the game source.
+     */
+    struct PublishedBoard
+    {
+        QAtomicInteger<quint64> state; /*!< Packed state, see packState. */
+        QAtomicInt visible; /*!< Non zero if the board is visible. */
+    };
+
+    /*!
+     * \brief The DisplayedBoard struct State of the board shown by the view.
+     */
+    struct DisplayedBoard
+    {
+        QVariantList tiles; /*!< States of the tiles. */
+        int currentPlayer = PlayerX; /*!< Current player. */
+        int roundStatus = NotFinished; /*!< Round status. */
+        quint64 state = 0; /*!< Packed state shown. */
+    };
+
+    int m_boardsNumber; /*!< Number of boards. */
+    int m_boardSize; /*!< Number of tiles in a row of each board. */
+    QScopedArrayPointer<PublishedBoard> m_publishedBoards; /*!< Boards written by the game sources. */
+    QVector<DisplayedBoard> m_displayedBoards; /*!< Boards shown by the view. */
+    QSet<int> m_visibleBoards; /*!< Boards with delegates. */
+    QPointer<QQuickWindow> m_window; /*!< Window pacing the updates. */
+    QAtomicInt m_frameRequested; /*!< Non zero if the frame has been requested and not processed yet. */
+
+    /*!
+     * \brief packState Method packs the board into one word: crosses in bits 0-15, noughts in bits 16-31,
+     * current player in bit 32 and round status in bits 33-34.
+     * \param crossMask Bit mask of the tiles with crosses.
+     * \param noughtMask Bit mask of the tiles with noughts.
+     * \param currentPlayer Current player.
+     * \param roundStatus Round status.
+     * \return Packed state.
+     */
+    static quint64 packState(quint32 crossMask, quint32 noughtMask, int currentPlayer, int roundStatus);
+
+    /*!
+     * \brief updateDisplayedBoard Method copies the published board if it has changed.
+     * \param board Index of the board.
+     * \return True if the board has changed, False otherwise.
+     */
+    bool updateDisplayedBoard(int board);
+};
+
+#endif // SPECTATORMODEL_H
@@ -0,0 +1,270 @@
+#include "boardgeometry.h"
+
+const int BoardGeometry::KMaxBoardSize;
+
+BoardGeometry::BoardGeometry(int boardSize, int lineLength)
+{
+    m_boardSize = qBound(1, boardSize, KMaxBoardSize);
+    m_lineLength = qBound(1, lineLength, m_boardSize);
+    m_numberOfTiles = m_boardSize * m_boardSize;
+    m_tileLineMasks.resize(m_numberOfTiles);
+
+    // Horizontal, vertical, down diagonal and up diagonal lines.
+    for (int y = 0; y < m_boardSize; y++)
+    {
+        for (int x = 0; x < m_boardSize; x++)
+        {
+            addLine(x, y, 1, 0);
+            addLine(x, y, 0, 1);
+            addLine(x, y, 1, 1);
+            addLine(x, y, -1, 1);
+        }
+    }
+
+    for (int symmetry = 0; symmetry < KNumberOfSymmetries; symmetry++)
+    {
+        for (int tileIndex = 0; tileIndex < KMaxNumberOfTiles; tileIndex++)
+        {
+            m_tileTransforms[symmetry][tileIndex] = tileIndex;
+            m_inverseTileTransforms[symmetry][tileIndex] = tileIndex;
+        }
+
+        for (int tileIndex = 0; tileIndex < m_numberOfTiles; tileIndex++)
+        {
+            int transformed = transformPoint(tileIndex % m_boardSize, tileIndex / m_boardSize, symmetry);
+            m_tileTransforms[symmetry][tileIndex] = transformed;
+            m_inverseTileTransforms[symmetry][transformed] = tileIndex;
+        }
+
+        for (int half = 0; half < 2; half++)
+        {
+            for (int byte = 0; byte < 256; byte++)
+            {
+                quint32 transformed = 0;
+                for (int bit = 0; bit < 8; bit++)
+                {
+                    int tileIndex = half * 8 + bit;
+                    if ((byte & (1 << bit)) && tileIndex < m_numberOfTiles)
+                    {
+                        transformed |= 1u << m_tileTransforms[symmetry][tileIndex];
+                    }
+                }
+                m_maskTransforms[symmetry][half][byte] = static_cast<quint16>(transformed);
+            }
+        }
+    }
+
+    for (int half = 0; half < 2; half++)
+    {
+        for (int byte = 0; byte < 256; byte++)
+        {
+            quint32 index = 0;
+            quint32 power = half == 0 ? 1 : 6561; // 3^8
+            for (int bit = 0; bit < 8; bit++)
+            {
+                if (byte & (1 << bit))
+                {
+                    index += power;
+                }
+                power *= 3;
+            }
+            m_powersOfThree[half][byte] = index;
+        }
+    }
+}
+
+int BoardGeometry::boardSize() const
+{
+    return m_boardSize;
+}
+
+int BoardGeometry::lineLength() const
+{
+    return m_lineLength;
+}
+
+int BoardGeometry::numberOfTiles() const
+{
+    return m_numberOfTiles;
+}
+
+quint32 BoardGeometry::numberOfPositions() const
+{
+    quint32 positions = 1;
+    for (int tileIndex = 0; tileIndex < m_numberOfTiles; tileIndex++)
+    {
+        positions *= 3;
+    }
+
+    return positions;
+}
+
+quint32 BoardGeometry::fullMask() const
+{
+    return (1u << m_numberOfTiles) - 1;
+}
+
+bool BoardGeometry::completesLine(quint32 mask, int tileIndex) const
+{
+    for (quint32 lineMask : m_tileLineMasks[tileIndex])
+    {
+        if ((mask & lineMask) == lineMask)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool BoardGeometry::hasCompletedLine(quint32 mask) const
+{
+    for (quint32 lineMask : m_lineMasks)
+    {
+        if ((mask & lineMask) == lineMask)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+quint32 BoardGeometry::transformMask(quint32 mask, int symmetry) const
+{
+    return m_maskTransforms[symmetry][0][mask & 0xFF] | m_maskTransforms[symmetry][1][(mask >> 8) & 0xFF];
+}
+
+int BoardGeometry::transformTile(int tileIndex, int symmetry) const
+{
+    return m_tileTransforms[symmetry][tileIndex];
+}
+
+int BoardGeometry::inverseTransformTile(int tileIndex, int symmetry) const
+{
+    return m_inverseTileTransforms[symmetry][tileIndex];
+}
+
+quint32 BoardGeometry::positionIndex(quint32 moverMask, quint32 opponentMask) const
+{
+    quint32 moverIndex = m_powersOfThree[0][moverMask & 0xFF] + m_powersOfThree[1][(moverMask >> 8) & 0xFF];
+    quint32 opponentIndex = m_powersOfThree[0][opponentMask & 0xFF] + m_powersOfThree[1][(opponentMask >> 8) & 0xFF];
+
+    return moverIndex + 2 * opponentIndex;
+}
+
+void BoardGeometry::positionMasks(quint32 index, quint32& moverMask, quint32& opponentMask) const
+{
+    moverMask = 0;
+    opponentMask = 0;
+
+    for (int tileIndex = 0; tileIndex < m_numberOfTiles; tileIndex++)
+    {
+        quint32 digit = index % 3;
+        index /= 3;
+
+        if (digit == 1)
+        {
+            moverMask |= 1u << tileIndex;
+        }
+        else if (digit == 2)
+        {
+            opponentMask |= 1u << tileIndex;
+        }
+    }
+}
+
+quint32 BoardGeometry::canonicalIndex(quint32 moverMask, quint32 opponentMask, int* symmetry) const
+{
+    quint32 bestIndex = positionIndex(moverMask, opponentMask);
+    int bestSymmetry = 0;
+
+    for (int candidate = 1; candidate < KNumberOfSymmetries; candidate++)
+    {
+        quint32 index = positionIndex(transformMask(moverMask, candidate), transformMask(opponentMask, candidate));
+        if (index < bestIndex)
+        {
+            bestIndex = index;
+            bestSymmetry = candidate;
+        }
+    }
+
+    if (symmetry)
+    {
+        *symmetry = bestSymmetry;
+    }
+
+    return bestIndex;
+}
+
+void BoardGeometry::addLine(int x, int y, int dx, int dy)
+{
+    int lastX = x + dx * (m_lineLength - 1);
+    int lastY = y + dy * (m_lineLength - 1);
+    if (lastX < 0 || lastX >= m_boardSize || lastY < 0 || lastY >= m_boardSize)
+    {
+        return;
+    }
+
+    quint32 lineMask = 0;
+    for (int i = 0; i < m_lineLength; i++)
+    {
+        lineMask |= 1u << ((y + dy * i) * m_boardSize + x + dx * i);
+    }
+
+    // Lines of length one are added for each direction, skip duplicates.
+    if (m_lineMasks.contains(lineMask))
+    {
+        return;
+    }
+
+    m_lineMasks.append(lineMask);
+    for (int tileIndex = 0; tileIndex < m_numberOfTiles; tileIndex++)
+    {
+        if (lineMask & (1u << tileIndex))
+        {
+            m_tileLineMasks[tileIndex].append(lineMask);
+        }
+    }
+}
+
+int BoardGeometry::transformPoint(int x, int y, int symmetry) const
+{
+    int last = m_boardSize - 1;
+    int transformedX = x;
+    int transformedY = y;
+
+    switch (symmetry)
+    {
+    case 1: // Rotation by 90 degrees.
+        transformedX = last - y;
+        transformedY = x;
+        break;
+    case 2: // Rotation by 180 degrees.
+        transformedX = last - x;
+        transformedY = last - y;
+        break;
+    case 3: // Rotation by 270 degrees.
+        transformedX = y;
+        transformedY = last - x;
+        break;
+    case 4: // Horizontal reflection.
+        transformedX = last - x;
+        break;
+    case 5: // Vertical reflection.
+        transformedY = last - y;
+        break;
+    case 6: // Reflection over the down diagonal.
+        transformedX = y;
+        transformedY = x;
+        break;
+    case 7: // Reflection over the up diagonal.
+        transformedX = last - y;
+        transformedY = last - x;
+        break;
+    default:
+        break;
+    }
+
+    return transformedY * m_boardSize + transformedX;
+}
@@ -0,0 +1,152 @@
+#ifndef BOARDGEOMETRY_H
+#define BOARDGEOMETRY_H
+
+#include <QtGlobal>
+#include <QVector>
+
+/*!
+ * \brief The BoardGeometry class Class describing square game board of up to 4x4 tiles as bit masks.
+ *
+ * Tile with index i (i = y * boardSize + x, the same as in the Engine) is represented by bit i of the mask.
+ * The class provides winning lines of the given length, the eight symmetries of the square board
+ * and conversion of the board to the base-3 position index used by the tablebase.
+ */
+class BoardGeometry
+{
+public:
+    static const int KMaxBoardSize = 4; /*!< Maximum supported board size. */
+    static const int KMaxNumberOfTiles = KMaxBoardSize * KMaxBoardSize; /*!< Maximum supported number of tiles. */
+    static const int KNumberOfSymmetries = 8; /*!< Number of symmetries of the square board (rotations and reflections). */
+
+    /*!
+     * \brief BoardGeometry Constructor.
+     * \param boardSize Size of the board (number of tiles in a row).
+     * \param lineLength Number of tiles of the same type in a row needed to win.
+     */
+    BoardGeometry(int boardSize = 3, int lineLength = 3);
+
+    /*!
+     * \brief boardSize Getter method returning board size.
+     * \return Board size.
+     */
+    int boardSize() const;
+
+    /*!
+     * \brief lineLength Getter method returning length of the winning line.
+     * \return Winning line length.
+     */
+    int lineLength() const;
+
+    /*!
+     * \brief numberOfTiles Getter method returning total number of tiles on the board.
+     * \return Number of tiles.
+     */
+    int numberOfTiles() const;
+
+    /*!
+     * \brief numberOfPositions Method returns the number of base-3 position indexes (3 to the power of number of tiles).
+     * \return Number of position indexes.
+     */
+    quint32 numberOfPositions() const;
+
+    /*!
+     * \brief fullMask Method returns mask with all tiles of the board set.
+     * \return Full board mask.
+     */
+    quint32 fullMask() const;
+
+    /*!
+     * \brief completesLine Method checks if any winning line going through the given tile is fully covered by the mask.
+     * \param mask Mask of the tiles of one player.
+     * \param tileIndex Index of the most recently placed tile.
+     * \return True if line has been completed, False otherwise.
+     */
+    bool completesLine(quint32 mask, int tileIndex) const;
+
+    /*!
+     * \brief hasCompletedLine Method checks if any winning line is fully covered by the mask.
+     * \param mask Mask of the tiles of one player.
+     * \return True if line has been completed, False otherwise.
+     */
+    bool hasCompletedLine(quint32 mask) const;
+
+    /*!
+     * \brief transformMask Method applies one of the board symmetries to the mask.
+     * \param mask Mask to be transformed.
+     * \param symmetry Index of the symmetry in range [0, KNumberOfSymmetries).
+     * \return Transformed mask.
+     */
+    quint32 transformMask(quint32 mask, int symmetry) const;
+
+    /*!
+     * \brief transformTile Method applies one of the board symmetries to the tile index.
+     * \param tileIndex Index of the tile.
+     * \param symmetry Index of the symmetry.
+     * \return Transformed tile index.
+     */
+    int transformTile(int tileIndex, int symmetry) const;
+
+    /*!
+     * \brief inverseTransformTile Method reverts one of the board symmetries for the tile index.
+     * \param tileIndex Index of the transformed tile.
+     * \param symmetry Index of the symmetry.
+     * \return Original tile index.
+     */
+    int inverseTransformTile(int tileIndex, int symmetry) const;
+
+    /*!
+     * \brief positionIndex Method converts the position to base-3 index (0 - empty, 1 - player to move, 2 - opponent).
+     * \param moverMask Tiles of the player to move.
+     * \param opponentMask Tiles of the opponent.
+     * \return Position index.
+     */
+    quint32 positionIndex(quint32 moverMask, quint32 opponentMask) const;
+
+    /*!
+     * \brief positionMasks Method converts base-3 position index back to tile masks.
+     * \param index Position index.
+     * \param moverMask Output tiles of the player to move.
+     * \param opponentMask Output tiles of the opponent.
+     */
+    void positionMasks(quint32 index, quint32& moverMask, quint32& opponentMask) const;
+
+    /*!
+     * \brief canonicalIndex Method returns the smallest position index among all symmetric variants of the position.
+     * \param moverMask Tiles of the player to move.
+     * \param opponentMask Tiles of the opponent.
+     * \param symmetry Optional output symmetry which transforms the position to its canonical form.
+     * \return Canonical position index.
+     */
+    quint32 canonicalIndex(quint32 moverMask, quint32 opponentMask, int* symmetry = nullptr) const;
+
+private:
+    int m_boardSize; /*!< Board size. */
+    int m_lineLength; /*!< Winning line length. */
+    int m_numberOfTiles; /*!< Number of tiles on the board. */
+    QVector<quint32> m_lineMasks; /*!< Masks of all winning lines. */
+    QVector<QVector<quint32>> m_tileLineMasks; /*!< Masks of winning lines going through each tile. */
+    int m_tileTransforms[KNumberOfSymmetries][KMaxNumberOfTiles]; /*!< Tile index permutation for each symmetry. */
+    int m_inverseTileTransforms[KNumberOfSymmetries][KMaxNumberOfTiles]; /*!< Inverse tile index permutation for each symmetry. */
+    quint16 m_maskTransforms[KNumberOfSymmetries][2][256]; /*!< Transformed masks for low and high byte of the mask for each symmetry. */
+    quint32 m_powersOfThree[2][256]; /*!< Base-3 index contribution of low and high byte of the mask. */
+
+    /*!
+     * \brief addLine Method adds winning line starting at the given tile and going in the given direction.
+     * \param x Column of the first tile.
+     * \param y Row of the first tile.
+     * \param dx Column step.
+     * \param dy Row step.
+     */
+    void addLine(int x, int y, int dx, int dy);
+
+    /*!
+     * \brief transformPoint Method applies symmetry to the tile coordinates.
+     * \param x Column of the tile.
+     * \param y Row of the tile.
+     * \param symmetry Index of the symmetry.
+     * \return Index of the transformed tile.
+     */
+    int transformPoint(int x, int y, int symmetry) const;
+};
+
+#endif // BOARDGEOMETRY_H
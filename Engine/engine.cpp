@@ -1,88 +1,131 @@
 #include "engine.h"
+#include "tablebase.h"
+#include "threatindex.h"
 
-Engine::Engine(QObject *parent) : QObject(parent)
+Engine::Engine(QObject *parent) : GameEngine(parent), m_threatIndex(new ThreatIndex(KBoardSize, KBoardSize))
 {
     m_playerTileMapping.insert(PlayerO, Nought);
     m_playerTileMapping.insert(PlayerX, Cross);
 
-    m_scoreMap.insert(PlayerO, std::move(Score()));
-    m_scoreMap.insert(PlayerX, std::move(Score()));
-    m_currentPlayer = EPlayerType::PlayerX;
     resetRoundParameters();
 }
 
+Engine::~Engine()
+{
+}
+
 void Engine::resetRoundParameters()
 {
+    GameEngine::resetRoundParameters();
+
     for (int tileIndex = 0; tileIndex < KNumberOfTiles; tileIndex++)
     {
         m_tileStates[tileIndex] = ETileState::Empty;
     }
 
     m_moveCounter = 0;
-    m_roundStatus = NotFinished; 
+    m_threatIndex->clear();
 }
 
-void Engine::startNextRound()
+bool Engine::loadTablebase(const QString& filePath)
 {
-    if (m_currentPlayer == EPlayerType::PlayerO) {
-        m_currentPlayer = EPlayerType::PlayerX;
-    } else {
-        m_currentPlayer = EPlayerType::PlayerO;
+    // The tablebase and its geometry tables are created only here, engines which never load one do not pay for them.
+    m_tablebase.reset();
+
+    QScopedPointer<Tablebase> tablebase(new Tablebase());
+    if (!tablebase->open(filePath))
+    {
+        return false;
     }
 
-    resetRoundParameters();
+    if (tablebase->boardSize() != KBoardSize || tablebase->lineLength() != KBoardSize)
+    {
+        return false;
+    }
+
+    m_tablebase.swap(tablebase);
 
-    emit roundStatusChanged();
-    emit winsNumberChanged();
-    emit drawsNumberChanged();
-    emit currentPlayerChanged();
+    return true;
 }
 
-void Engine::changePlayer()
+int Engine::getPositionValue() const
 {
-    if (m_currentPlayer == EPlayerType::PlayerO)
-    {
-        m_currentPlayer = EPlayerType::PlayerX;
-    }
-    else
-    {
-        m_currentPlayer = EPlayerType::PlayerO;
-    }
+    return probeTablebase().value;
+}
 
-    emit currentPlayerChanged();
+int Engine::getBestMove() const
+{
+    return probeTablebase().bestMove;
 }
 
-int Engine::getTileType(int index) const
+int Engine::getPositionDistance() const
 {
-    return m_tileStates[index];
+    return probeTablebase().distance;
+}
+
+int Engine::getThreatCount(int player, int length, int ends) const
+{
+    return m_threatIndex->threatCount(static_cast<EPlayerType>(player), length, static_cast<ERunEnds>(ends));
 }
 
-int Engine::getCurrentPlayer() const
+const ThreatIndex& Engine::threatIndex() const
 {
-    return m_currentPlayer;
+    return *m_threatIndex;
+}
+
+TablebaseEntry Engine::probeTablebase() const
+{
+    if (!m_tablebase || m_roundStatus != ERoundStatus::NotFinished)
+    {
+        return TablebaseEntry();
+    }
+
+    quint32 moverMask = 0;
+    quint32 opponentMask = 0;
+    ETileState moverTile = m_playerTileMapping[m_currentPlayer];
+
+    for (int tileIndex = 0; tileIndex < KNumberOfTiles; tileIndex++)
+    {
+        if (m_tileStates[tileIndex] == moverTile)
+        {
+            moverMask |= 1u << tileIndex;
+        }
+        else if (m_tileStates[tileIndex] != ETileState::Empty)
+        {
+            opponentMask |= 1u << tileIndex;
+        }
+    }
+
+    return m_tablebase->probe(moverMask, opponentMask);
 }
 
-int Engine::getRoundStatus() const
+int Engine::getTileType(int index) const
 {
-    return m_roundStatus;
+    if (index < 0 || index >= KNumberOfTiles)
+    {
+        return ETileState::Empty;
+    }
+
+    return m_tileStates[index];
 }
 
-int Engine::getDrawsNumberForCurrentPlayer()
+bool Engine::isTilePlayable(int index) const
 {
-    return m_scoreMap[m_currentPlayer].draws();
+    return m_roundStatus == ERoundStatus::NotFinished && index >= 0 && index < KNumberOfTiles && m_tileStates[index] == ETileState::Empty;
 }
 
-int Engine::getWinsNumberForCurrentPlayer()
+int Engine::getBoardSize() const
 {
-    return m_scoreMap[m_currentPlayer].wins();
+    return KBoardSize;
 }
 
 void Engine::updateTileState(int index)
 {
-    m_moveCounter++;
-
-    if (index >= 0 && index <= KNumberOfTiles)
+    // Only empty tiles of the board can be updated and only while the round is ongoing.
+    if (Engine::isTilePlayable(index))
     {
+        m_moveCounter++;
+
         switch (m_currentPlayer)
         {
         case EPlayerType::PlayerO:
@@ -96,49 +139,13 @@ void Engine::updateTileState(int index)
             break;
         }
 
+        m_threatIndex->placeTile(index, m_currentPlayer);
+
         emit tileStateChanged(index);
         processTileStateChange(index);
     }
 }
 
-void Engine::processTileStateChange(int index)
-{
-    checkForRoundCompletion(index);
-
-    // Handle round status. In case it is not finished change player and notify about wins and draws numbers changes for the current player.
-    if (m_roundStatus == ERoundStatus::NotFinished)
-    {
-        changePlayer();
-        emit winsNumberChanged();
-        emit drawsNumberChanged();
-    }
-    else
-    {    
-        if (m_roundStatus == ERoundStatus::FinishedWin)
-        {
-            // Update wins number for the current player.
-            int currentWins = m_scoreMap[m_currentPlayer].wins();
-            m_scoreMap[m_currentPlayer].setWins(currentWins + 1);
-            emit winsNumberChanged();
-        }
-        else if (m_roundStatus == ERoundStatus::FinishedDraw)
-        {
-            // Update draws number for both players.
-            auto it = m_scoreMap.begin();
-            int currentDraws = 0;
-            while (it != m_scoreMap.end())
-            {
-                currentDraws = it.value().draws();
-                it.value().setDraws(currentDraws + 1);
-                it++;
-                emit drawsNumberChanged();
-            }
-        }
-
-        emit roundStatusChanged();
-    }
-}
-
 void Engine::checkForRoundCompletion(int lastIndex)
 {
     if (checkForCompletedLines(lastIndex)) {
@@ -1,61 +1,14 @@
 #ifndef ENGINE_H
 #define ENGINE_H
 
-#include <QObject>
 #include <QPoint>
 #include <QMap>
-#include "score.h"
+#include <QScopedPointer>
+#include "gameengine.h"
 
-/// Namespace with enum types used both on C++ and QML sides.
-namespace Enums {
-Q_NAMESPACE
-
-/*!
- * \brief The EPlayerType enum Player types corresponding to noughts and crosses.
- */
-enum EPlayerType {
-    PlayerO,
-    PlayerX
-};
-
-/*!
- * \brief The ETileState enum Tile states.
- */
-enum ETileState {
-    Nought,
-    Cross,
-    Empty
-};
-
-/*!
- * \brief The ERoundStatus enum Enum representing possible round statuses.
- */
-enum ERoundStatus {
-    FinishedWin,
-    FinishedDraw,
-    NotFinished
-};
-
-/*!
- * \brief The ELineType enum Enum representing types of the crossing lines indicating full tiles line completion.
- */
-enum ELineType {
-    HorizontalLine,
-    VerticalLine,
-    DownDiagonalLine,
-    UpDiagonalLine
-};
-
-
-
-Q_ENUM_NS(ETileState);
-Q_ENUM_NS(ERoundStatus);
-Q_ENUM_NS(EPlayerType);
-Q_ENUM_NS(ELineType);
-
-}
-
-using namespace Enums;
+class Tablebase;
+class ThreatIndex;
+struct TablebaseEntry;
 
 /*!
  * \brief The Engine class Class representing Naughts and Crosses game engine.
@@ -63,8 +16,9 @@ using namespace Enums;
  * The engine class stores and updates tiles states. It is also responsible for checking status of the game rounds completion.
  * Once the game round has finished the engine sends notification by emitting appropriate signals.
  * The round is finished when line (horizontal, vertical or diagonal) of tiles is fully filled with noughts or crosses states.
+ * Only the classic board keeps a tablebase and a threat index, both describe its KBoardSize board.
  */
-class Engine : public QObject
+class Engine : public GameEngine
 {
     Q_OBJECT
 
@@ -75,6 +29,10 @@ public:
      */
     Engine(QObject* parent = nullptr);
 
+    /*!
+     * \brief ~Engine Destructor.
+     */
+    virtual ~Engine();
 
     static const int KBoardSize = 3; /*!< Constant value representing game board size. */
     static const int KNumberOfTiles = KBoardSize * KBoardSize; /*!< Total number of tiles on the game board. */
@@ -82,107 +40,91 @@ public:
 
     /*!
      * \brief updateTileState Method updates given tile state and check game round for completion.
+     * Tiles out of the board, already occupied tiles and moves after the end of the round are ignored.
      * \param index Tile index to update state for.
      */
-    void updateTileState(int index);
+    void updateTileState(int index) override;
 
     /*!
      * \brief getTileType Method returns the type of the given tile.
      * \param index Tile index to return state for.
-     * \return State of the tile.
-     */
-    int getTileType(int index) const;
-
-    /*!
-     * \brief getCurrentPlayer Method returns current player type.
-     * \return Current player type.
+     * \return State of the tile, Empty for tiles out of the board.
      */
-    int getCurrentPlayer() const;
+    int getTileType(int index) const override;
 
     /*!
-     * \brief getRoundStatus Method returns current round status.
-     * \return Current round status.
+     * \brief isTilePlayable Method checks if the current player is allowed to place the tile.
+     * No tile is playable once the round has finished.
+     * \param index Tile index to be checked.
+     * \return True if the tile can be updated, False otherwise.
      */
-    int getRoundStatus() const;
+    bool isTilePlayable(int index) const override;
 
     /*!
-     * \brief getDrawsNumberForCurrentPlayer Method returns number of draws for current player.
-     * \return Number of draws.
+     * \brief getBoardSize Method returns number of tiles in a row of the game board.
+     * \return Game board size.
      */
-    int getDrawsNumberForCurrentPlayer();
+    int getBoardSize() const override;
 
     /*!
-     * \brief getWinsNumberForCurrentPlayerMethod returns number of wins for current player.
-     * \return Number of wins.
+     * \brief loadTablebase Method loads the tablebase used for answering position value and best move queries.
+     * The tablebase is accepted only if it has been generated for the engine board size and full line win condition.
+     * \param filePath Path to the tablebase file.
+     * \return True if the tablebase has been loaded, False otherwise.
      */
-    int getWinsNumberForCurrentPlayer();
+    bool loadTablebase(const QString& filePath) override;
 
     /*!
-     * \brief startNextRound Methods resets the engine state before starting the next round.
+     * \brief getPositionValue Method returns value of the current position for the current player.
+     * \return Position value, UnknownPosition if there is no tablebase loaded.
      */
-    void startNextRound();
+    int getPositionValue() const override;
 
-signals:
     /*!
-     * \brief tileStateChanged Signal indicating that tile state has been changed.
-     * \param index Tile index.
+     * \brief getBestMove Method returns the best move for the current player.
+     * \return Tile index of the best move, -1 if it is unknown or the round is finished.
      */
-    void tileStateChanged(int index);
+    int getBestMove() const override;
 
     /*!
-     * \brief currentPlayerChanged Signal indicatin that current player has changed.
+     * \brief getPositionDistance Method returns number of moves until the end of the round with perfect play.
+     * \return Number of moves, 0 if it is unknown or the round is finished.
      */
-    void currentPlayerChanged();
+    int getPositionDistance() const override;
 
     /*!
-     * \brief lineCompleted Signal indicating that line of tiles on the game board has been completed with tiles of the same type.
-     * \param lineType Type of the line. (Horizontal, Vertical or Diagonal)
-     * \param index Index indicating row or column of the completed line of tiles.
+     * \brief getThreatCount Method returns number of runs of tiles of the given class on the board.
+     * \param player Owner of the runs.
+     * \param length Length of the runs.
+     * \param ends Number of open ends of the runs (ERunEnds).
+     * \return Number of runs.
      */
-    void lineCompleted(int lineType, int index);
+    int getThreatCount(int player, int length, int ends) const;
 
     /*!
-     * \brief roundStatusChanged Signal indicating that round status has changed.
+     * \brief threatIndex Getter method returning index of runs of tiles, updated on each tile state change.
+     * \return Threat index.
      */
-    void roundStatusChanged();
+    const ThreatIndex& threatIndex() const;
 
+protected:
     /*!
-     * \brief drawsNumberChanged Signal indicating that number of draws of current player has been updated.
+     * \brief resetRoundParameters Method for resetting round parameters: tiles states, turns counter, round status.
      */
-    void drawsNumberChanged();
+    void resetRoundParameters() override;
 
     /*!
-     * \brief winsNumberChanged Signal indicating that number of wins of the current player has been updated.
+     * \brief checkForRoundCompletion Method checks for round completion and updates the round status accordingly.
+     * \param lastIndex Tile index which has been recently updated.
      */
-    void winsNumberChanged();
+    void checkForRoundCompletion(int lastIndex) override;
 
 private:
-    EPlayerType m_currentPlayer; /*!< Type of the current player. */
     ETileState m_tileStates[KNumberOfTiles]; /*!< Array of the tiles states. */
-    ERoundStatus m_roundStatus; /*!< Status of the current round. */
     QMap<EPlayerType, ETileState> m_playerTileMapping; /*!< Mapping between player type and corresponding tile type */
-    QMap<EPlayerType, Score> m_scoreMap; /*!< Map storing scores for each player. */
     int m_moveCounter; /*!< Counter of compleded turns (tiles states changes) in the current round. */
-
-
-    /*!
-     * \brief resetRoundParameters Method for resetting round parameters: tiles states, turns counter, round status.
-     */
-    void resetRoundParameters();
-
-    /*!
-     * \brief processTileStateChange This method is called every time after tile state change.
-     * In case round is not completed it causes current player to be changed.
-     * Otherwise it updates the player scores accordingly and emits appropriate signals.
-     * \param index Tile index which has been recently updated.
-     */
-    void processTileStateChange(int index);
-
-    /*!
-     * \brief checkForRoundCompletion Method checks for round completion and updates the round status accordingly.
-     * \param lastIndex Tile index which has been recently updated.
-     */
-    void checkForRoundCompletion(int lastIndex);
+    QScopedPointer<Tablebase> m_tablebase; /*!< Tablebase with solved positions, nullptr until one is loaded. */
+    QScopedPointer<ThreatIndex> m_threatIndex; /*!< Index of runs of tiles of the same type. */
 
     /*!
      * \brief indexToPoint Method for convering tile index to xy positions on the game board.
@@ -239,9 +181,10 @@ private:
     bool checkUpDiagonalForCompletion() const;
 
     /*!
-     * \brief changePlayer Method changes the current player.
+     * \brief probeTablebase Method queries the tablebase for the current position.
+     * \return Tablebase entry of the current position.
      */
-    void changePlayer();
+    TablebaseEntry probeTablebase() const;
 };
 
 #endif // ENGINE_H
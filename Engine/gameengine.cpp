@@ -0,0 +1,128 @@
+#include "gameengine.h"
+
+GameEngine::GameEngine(QObject *parent) : QObject(parent)
+{
+    m_scoreMap.insert(PlayerO, std::move(Score()));
+    m_scoreMap.insert(PlayerX, std::move(Score()));
+    m_currentPlayer = EPlayerType::PlayerX;
+    m_roundStatus = NotFinished;
+}
+
+GameEngine::~GameEngine()
+{
+}
+
+void GameEngine::resetRoundParameters()
+{
+    m_roundStatus = NotFinished;
+}
+
+void GameEngine::startNextRound()
+{
+    if (m_currentPlayer == EPlayerType::PlayerO) {
+        m_currentPlayer = EPlayerType::PlayerX;
+    } else {
+        m_currentPlayer = EPlayerType::PlayerO;
+    }
+
+    resetRoundParameters();
+
+    emit roundStatusChanged();
+    emit winsNumberChanged();
+    emit drawsNumberChanged();
+    emit currentPlayerChanged();
+}
+
+bool GameEngine::loadTablebase(const QString& filePath)
+{
+    Q_UNUSED(filePath);
+
+    return false;
+}
+
+int GameEngine::getPositionValue() const
+{
+    return UnknownPosition;
+}
+
+int GameEngine::getBestMove() const
+{
+    return -1;
+}
+
+int GameEngine::getPositionDistance() const
+{
+    return 0;
+}
+
+void GameEngine::changePlayer()
+{
+    if (m_currentPlayer == EPlayerType::PlayerO)
+    {
+        m_currentPlayer = EPlayerType::PlayerX;
+    }
+    else
+    {
+        m_currentPlayer = EPlayerType::PlayerO;
+    }
+
+    emit currentPlayerChanged();
+}
+
+int GameEngine::getCurrentPlayer() const
+{
+    return m_currentPlayer;
+}
+
+int GameEngine::getRoundStatus() const
+{
+    return m_roundStatus;
+}
+
+int GameEngine::getDrawsNumberForCurrentPlayer()
+{
+    return m_scoreMap[m_currentPlayer].draws();
+}
+
+int GameEngine::getWinsNumberForCurrentPlayer()
+{
+    return m_scoreMap[m_currentPlayer].wins();
+}
+
+void GameEngine::processTileStateChange(int index)
+{
+    checkForRoundCompletion(index);
+
+    // Handle round status. In case it is not finished change player and notify about wins and draws numbers changes for the current player.
+    if (m_roundStatus == ERoundStatus::NotFinished)
+    {
+        changePlayer();
+        emit winsNumberChanged();
+        emit drawsNumberChanged();
+    }
+    else
+    {
+        if (m_roundStatus == ERoundStatus::FinishedWin)
+        {
+            // Update wins number for the current player.
+            int currentWins = m_scoreMap[m_currentPlayer].wins();
+            m_scoreMap[m_currentPlayer].setWins(currentWins + 1);
+            emit winsNumberChanged();
+        }
+        else if (m_roundStatus == ERoundStatus::FinishedDraw)
+        {
+            // Update draws number for both players.
+            auto it = m_scoreMap.begin();
+            int currentDraws = 0;
+            while (it != m_scoreMap.end())
+            {
+                currentDraws = it.value().draws();
+                it.value().setDraws(currentDraws + 1);
+                it++;
+                emit drawsNumberChanged();
+            }
+        }
+
+        emit roundStatusChanged();
+    }
+}
@@ -0,0 +1,251 @@
+#ifndef GAMEENGINE_H
+#define GAMEENGINE_H
+
+#include <QObject>
+#include <QMap>
+#include "score.h"
+
+/// Namespace with enum types used both on C++ and QML sides.
+namespace Enums {
+Q_NAMESPACE
+
+/*!
+ * \brief The EPlayerType enum Player types corresponding to noughts and crosses.
+ */
+enum EPlayerType {
+    PlayerO,
+    PlayerX
+};
+
+/*!
+ * \brief The ETileState enum Tile states.
+ */
+enum ETileState {
+    Nought,
+    Cross,
+    Empty
+};
+
+/*!
+ * \brief The ERoundStatus enum Enum representing possible round statuses.
+ */
+enum ERoundStatus {
+    FinishedWin,
+    FinishedDraw,
+    NotFinished
+};
+
+/*!
+ * \brief The ELineType enum Enum representing types of the crossing lines indicating full tiles line completion.
+ */
+enum ELineType {
+    HorizontalLine,
+    VerticalLine,
+    DownDiagonalLine,
+    UpDiagonalLine
+};
+
+/*!
+ * \brief The ERunEnds enum Enum representing number of empty tiles at the ends of the run of tiles of the same type.
+ */
+enum ERunEnds {
+    ClosedRun,
+    HalfOpenRun,
+    OpenRun
+};
+
+/*!
+ * \brief The EPositionValue enum Game theoretical value of the position for the player to move.
+ */
+enum EPositionValue {
+    UnknownPosition,
+    WinningPosition,
+    DrawnPosition,
+    LosingPosition
+};
+
+
+Q_ENUM_NS(ETileState);
+Q_ENUM_NS(ERoundStatus);
+Q_ENUM_NS(EPlayerType);
+Q_ENUM_NS(ELineType);
+Q_ENUM_NS(ERunEnds);
+Q_ENUM_NS(EPositionValue);
+
+}
+
+using namespace Enums;
+
+/*!
+ * \brief The GameEngine class Base class of the game engines, shared by the classic and the ultimate variant.
+ *
+ * The class keeps the state common to all variants: current player, round status and scores of both players.
+ * It also drives the round flow and emits the signals observed by the controller. The board itself, move legality
+ * and round completion are left to the variants. Tablebase queries are answered only by variants which have one,
+ * the default implementations report the position as unknown.
+ */
+class GameEngine : public QObject
+{
+    Q_OBJECT
+
+public:
+    /*!
+     * \brief GameEngine Constructor.
+     * \param parent Parent QObject.
+     */
+    GameEngine(QObject* parent = nullptr);
+
+    /*!
+     * \brief ~GameEngine Destructor.
+     */
+    virtual ~GameEngine();
+
+    /*!
+     * \brief updateTileState Method updates given tile state and check game round for completion.
+     * Illegal moves and moves after the end of the round are ignored.
+     * \param index Tile index to update state for.
+     */
+    virtual void updateTileState(int index) = 0;
+
+    /*!
+     * \brief getTileType Method returns the type of the given tile.
+     * \param index Tile index to return state for.
+     * \return State of the tile, Empty for tiles out of the board.
+     */
+    virtual int getTileType(int index) const = 0;
+
+    /*!
+     * \brief isTilePlayable Method checks if the current player is allowed to place the tile.
+     * No tile is playable once the round has finished.
+     * \param index Tile index to be checked.
+     * \return True if the tile can be updated, False otherwise.
+     */
+    virtual bool isTilePlayable(int index) const = 0;
+
+    /*!
+     * \brief getBoardSize Method returns number of tiles in a row of the game board.
+     * \return Game board size.
+     */
+    virtual int getBoardSize() const = 0;
+
+    /*!
+     * \brief loadTablebase Method loads the tablebase used for answering position value and best move queries.
+     * \param filePath Path to the tablebase file.
+     * \return True if the tablebase has been loaded, False otherwise. Always False if the variant has no tablebase.
+     */
+    virtual bool loadTablebase(const QString& filePath);
+
+    /*!
+     * \brief getPositionValue Method returns value of the current position for the current player.
+     * \return Position value, UnknownPosition if there is no tablebase loaded.
+     */
+    virtual int getPositionValue() const;
+
+    /*!
+     * \brief getBestMove Method returns the best move for the current player.
+     * \return Tile index of the best move, -1 if it is unknown or the round is finished.
+     */
+    virtual int getBestMove() const;
+
+    /*!
+     * \brief getPositionDistance Method returns number of moves until the end of the round with perfect play.
+     * \return Number of moves, 0 if it is unknown or the round is finished.
+     */
+    virtual int getPositionDistance() const;
+
+    /*!
+     * \brief getCurrentPlayer Method returns current player type.
+     * \return Current player type.
+     */
+    int getCurrentPlayer() const;
+
+    /*!
+     * \brief getRoundStatus Method returns current round status.
+     * \return Current round status.
+     */
+    int getRoundStatus() const;
+
+    /*!
+     * \brief getDrawsNumberForCurrentPlayer Method returns number of draws for current player.
+     * \return Number of draws.
+     */
+    int getDrawsNumberForCurrentPlayer();
+
+    /*!
+     * \brief getWinsNumberForCurrentPlayerMethod returns number of wins for current player.
+     * \return Number of wins.
+     */
+    int getWinsNumberForCurrentPlayer();
+
+    /*!
+     * \brief startNextRound Methods resets the engine state before starting the next round.
+     */
+    void startNextRound();
+
+signals:
+    /*!
+     * \brief tileStateChanged Signal indicating that tile state has been changed.
+     * \param index Tile index.
+     */
+    void tileStateChanged(int index);
+
+    /*!
+     * \brief currentPlayerChanged Signal indicatin that current player has changed.
+     */
+    void currentPlayerChanged();
+
+    /*!
+     * \brief lineCompleted Signal indicating that line of tiles on the game board has been completed with tiles of the same type.
+     * \param lineType Type of the line. (Horizontal, Vertical or Diagonal)
+     * \param index Index indicating row or column of the completed line of tiles.
+     */
+    void lineCompleted(int lineType, int index);
+
+    /*!
+     * \brief roundStatusChanged Signal indicating that round status has changed.
+     */
+    void roundStatusChanged();
+
+    /*!
+     * \brief drawsNumberChanged Signal indicating that number of draws of current player has been updated.
+     */
+    void drawsNumberChanged();
+
+    /*!
+     * \brief winsNumberChanged Signal indicating that number of wins of the current player has been updated.
+     */
+    void winsNumberChanged();
+
+protected:
+    EPlayerType m_currentPlayer; /*!< Type of the current player. */
+    ERoundStatus m_roundStatus; /*!< Status of the current round. */
+
+    /*!
+     * \brief resetRoundParameters Method for resetting round parameters before the next round. Variants reset their board here.
+     */
+    virtual void resetRoundParameters();
+
+    /*!
+     * \brief processTileStateChange This method is called every time after tile state change.
+     * In case round is not completed it causes current player to be changed.
+     * Otherwise it updates the player scores accordingly and emits appropriate signals.
+     * \param index Tile index which has been recently updated.
+     */
+    void processTileStateChange(int index);
+
+    /*!
+     * \brief checkForRoundCompletion Method checks for round completion and updates the round status accordingly.
+     * \param lastIndex Tile index which has been recently updated.
+     */
+    virtual void checkForRoundCompletion(int lastIndex) = 0;
+
+private:
+    QMap<EPlayerType, Score> m_scoreMap; /*!< Map storing scores for each player. */
+
+    /*!
+     * \brief changePlayer Method changes the current player.
+     */
+    void changePlayer();
+};
+
+#endif // GAMEENGINE_H
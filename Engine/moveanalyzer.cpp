@@ -0,0 +1,152 @@
+#include "moveanalyzer.h"
+
+const int MoveAnalyzer::KMaxCacheSize;
+
+namespace {
+
+const int KAbandonCheckInterval = 4096; // Number of visited positions between checks for a newer request.
+
+}
+
+MoveAnalyzer::MoveAnalyzer(int boardSize, int lineLength, QObject *parent) :
+    QObject(parent),
+    m_geometry(boardSize, lineLength),
+    m_latestRequest(0),
+    m_currentRequest(0),
+    m_visitedPositions(0),
+    m_abandoned(false)
+{
+}
+
+void MoveAnalyzer::setLatestRequest(int requestId)
+{
+    m_latestRequest.storeRelease(requestId);
+}
+
+void MoveAnalyzer::openTablebase(const QString& filePath)
+{
+    // Only a tablebase of the analyzed board can answer the queries.
+    if (m_tablebase.open(filePath)
+            && (m_tablebase.boardSize() != m_geometry.boardSize() || m_tablebase.lineLength() != m_geometry.lineLength()))
+    {
+        m_tablebase.close();
+    }
+}
+
+void MoveAnalyzer::analyze(int requestId, uint moverMask, uint opponentMask)
+{
+    // Requests queued behind a newer one are skipped without any work.
+    if (m_latestRequest.loadAcquire() != requestId)
+    {
+        return;
+    }
+
+    m_currentRequest = requestId;
+    m_visitedPositions = 0;
+    m_abandoned = false;
+
+    if (m_cache.size() > KMaxCacheSize)
+    {
+        m_cache.clear();
+    }
+
+    QVector<int> values(m_geometry.numberOfTiles(), UnknownPosition);
+    QVector<int> distances(m_geometry.numberOfTiles(), 0);
+    quint32 emptyMask = m_geometry.fullMask() & ~(moverMask | opponentMask);
+
+    for (int tileIndex = 0; tileIndex < m_geometry.numberOfTiles(); tileIndex++)
+    {
+        if (!(emptyMask & (1u << tileIndex)))
+        {
+            continue;
+        }
+
+        quint32 newMoverMask = moverMask | (1u << tileIndex);
+        if (m_geometry.completesLine(newMoverMask, tileIndex))
+        {
+            values[tileIndex] = WinningPosition;
+            distances[tileIndex] = 1;
+            continue;
+        }
+
+        TablebaseEntry outcome = Tablebase::moveOutcome(Tablebase::unpackEntry(solve(opponentMask, newMoverMask)));
+        if (m_abandoned)
+        {
+            return;
+        }
+
+        values[tileIndex] = outcome.value;
+        distances[tileIndex] = outcome.distance;
+    }
+
+    emit analysisFinished(requestId, values, distances);
+}
+
+quint16 MoveAnalyzer::solve(quint32 moverMask, quint32 opponentMask)
+{
+    if (m_geometry.hasCompletedLine(opponentMask))
+    {
+        return Tablebase::packEntry(LosingPosition, -1, 0);
+    }
+
+    quint32 emptyMask = m_geometry.fullMask() & ~(moverMask | opponentMask);
+    if (emptyMask == 0)
+    {
+        return Tablebase::packEntry(DrawnPosition, -1, 0);
+    }
+
+    // Loaded tablebase answers in constant time, the search is only a fallback.
+    TablebaseEntry stored = m_tablebase.probe(moverMask, opponentMask);
+    if (stored.value != UnknownPosition)
+    {
+        return Tablebase::packEntry(stored.value, -1, stored.distance);
+    }
+
+    quint32 index = m_geometry.canonicalIndex(moverMask, opponentMask);
+    QHash<quint32, quint16>::const_iterator cached = m_cache.constFind(index);
+    if (cached != m_cache.constEnd())
+    {
+        return cached.value();
+    }
+
+    if (++m_visitedPositions % KAbandonCheckInterval == 0 && m_latestRequest.loadAcquire() != m_currentRequest)
+    {
+        m_abandoned = true;
+    }
+    if (m_abandoned)
+    {
+        return 0;
+    }
+
+    TablebaseEntry best;
+
+    for (int tileIndex = 0; tileIndex < m_geometry.numberOfTiles(); tileIndex++)
+    {
+        if (!(emptyMask & (1u << tileIndex)))
+        {
+            continue;
+        }
+
+        quint32 newMoverMask = moverMask | (1u << tileIndex);
+        TablebaseEntry outcome;
+        outcome.value = WinningPosition;
+        outcome.distance = 1;
+
+        if (!m_geometry.completesLine(newMoverMask, tileIndex))
+        {
+            outcome = Tablebase::moveOutcome(Tablebase::unpackEntry(solve(opponentMask, newMoverMask)));
+            if (m_abandoned)
+            {
+                return 0;
+            }
+        }
+
+        Tablebase::combineMove(best, tileIndex, outcome);
+    }
+
+    // Only the value and the distance are cached, the best move depends on the orientation of the board.
+    quint16 entry = Tablebase::packEntry(best.value, -1, best.distance);
+    m_cache.insert(index, entry);
+
+    return entry;
+}
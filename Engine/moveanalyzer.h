@@ -0,0 +1,84 @@
+#ifndef MOVEANALYZER_H
+#define MOVEANALYZER_H
+
+#include <QAtomicInt>
+#include <QHash>
+#include <QObject>
+#include <QVector>
+
+#include "boardgeometry.h"
+#include "tablebase.h"
+
+/*!
+ * \brief The MoveAnalyzer class Worker evaluating every empty tile of the position with perfect play.
+ *
+ * The analyzer is meant to live in a background thread and to be driven with queued calls of analyze.
+ * Solved positions are cached in symmetry-reduced form and the cache is kept between the requests,
+ * so after each move only positions not seen before are solved. A request is abandoned as soon as a newer
+ * one is announced with setLatestRequest; positions solved until then stay in the cache.
+ * If a tablebase of the board has been opened with openTablebase, positions are probed there before searching.
+ */
+class MoveAnalyzer : public QObject
+{
+    Q_OBJECT
+
+public:
+    static const int KMaxCacheSize = 1 << 22; /*!< Number of cached positions after which the cache is cleared. */
+
+    /*!
+     * \brief MoveAnalyzer Constructor.
+     * \param boardSize Size of the board (up to BoardGeometry::KMaxBoardSize).
+     * \param lineLength Number of tiles of the same type in a row needed to win.
+     * \param parent Parent QObject.
+     */
+    MoveAnalyzer(int boardSize, int lineLength, QObject* parent = nullptr);
+
+    /*!
+     * \brief setLatestRequest Method announces the newest request, older requests are abandoned. Thread safe.
+     * \param requestId Identifier of the newest request.
+     */
+    void setLatestRequest(int requestId);
+
+public slots:
+    /*!
+     * \brief openTablebase Method maps the tablebase used instead of the search. Tablebases of other boards are ignored.
+     * \param filePath Path to the tablebase file.
+     */
+    void openTablebase(const QString& filePath);
+
+    /*!
+     * \brief analyze Method evaluates all empty tiles of the position and emits analysisFinished.
+     * \param requestId Identifier of the request.
+     * \param moverMask Tiles of the player to move.
+     * \param opponentMask Tiles of the opponent.
+     */
+    void analyze(int requestId, uint moverMask, uint opponentMask);
+
+signals:
+    /*!
+     * \brief analysisFinished Signal emitted when all empty tiles have been evaluated.
+     * \param requestId Identifier of the request.
+     * \param values Outcome (EPositionValue) for the player to move after moving to each tile, UnknownPosition for occupied tiles.
+     * \param distances Number of moves until the end of the round after moving to each tile, counting the move itself.
+     */
+    void analysisFinished(int requestId, QVector<int> values, QVector<int> distances);
+
+private:
+    BoardGeometry m_geometry; /*!< Geometry of the analyzed board. */
+    Tablebase m_tablebase; /*!< Tablebase of the analyzed board, closed if none has been opened. */
+    QHash<quint32, quint16> m_cache; /*!< Solved positions (packed tablebase entries) by canonical position index. */
+    QAtomicInt m_latestRequest; /*!< Identifier of the newest request. */
+    int m_currentRequest; /*!< Identifier of the request being analyzed. */
+    int m_visitedPositions; /*!< Number of positions visited by the current request, used for abandon checks. */
+    bool m_abandoned; /*!< True if the current request has been abandoned. */
+
+    /*!
+     * \brief solve Method solves the position recursively using and filling the cache.
+     * \param moverMask Tiles of the player to move.
+     * \param opponentMask Tiles of the opponent.
+     * \return Packed tablebase entry of the position, not meaningful if the request has been abandoned.
+     */
+    quint16 solve(quint32 moverMask, quint32 opponentMask);
+};
+
+#endif // MOVEANALYZER_H
@@ -0,0 +1,228 @@
+#include "tablebase.h"
+
+#include <QtAlgorithms>
+#include <cstring>
+
+const char Tablebase::KMagic[4] = { 'N', 'C', 'T', 'B' };
+
+Tablebase::Tablebase() :
+    m_data(nullptr),
+    m_header(nullptr),
+    m_bitmap(nullptr),
+    m_rankBlocks(nullptr),
+    m_entries(nullptr)
+{
+}
+
+bool Tablebase::open(const QString& filePath)
+{
+    close();
+
+    m_file.setFileName(filePath);
+    if (!m_file.open(QIODevice::ReadOnly))
+    {
+        return false;
+    }
+
+    qint64 fileSize = m_file.size();
+    if (fileSize < static_cast<qint64>(sizeof(TablebaseHeader)))
+    {
+        close();
+        return false;
+    }
+
+    m_data = m_file.map(0, fileSize);
+    if (!m_data)
+    {
+        close();
+        return false;
+    }
+
+    m_header = reinterpret_cast<const TablebaseHeader*>(m_data);
+    bool headerValid = memcmp(m_header->magic, KMagic, sizeof(KMagic)) == 0
+            && m_header->version == KVersion
+            && m_header->entryBits == KEntryBits
+            && m_header->boardSize >= 1 && m_header->boardSize <= BoardGeometry::KMaxBoardSize
+            && m_header->lineLength >= 1 && m_header->lineLength <= m_header->boardSize;
+    if (!headerValid)
+    {
+        close();
+        return false;
+    }
+
+    m_geometry = BoardGeometry(m_header->boardSize, m_header->lineLength);
+
+    qint64 bitmapWords = (static_cast<qint64>(m_header->numberOfPositions) + 63) / 64;
+    qint64 rankBlocks = (bitmapWords + KWordsPerRankBlock - 1) / KWordsPerRankBlock;
+    qint64 entryWords = (static_cast<qint64>(m_header->numberOfEntries) * KEntryBits + 63) / 64 + 1;
+
+    qint64 bitmapOffset = sizeof(TablebaseHeader);
+    qint64 rankOffset = bitmapOffset + bitmapWords * 8;
+    qint64 entriesOffset = rankOffset + ((rankBlocks * 4 + 7) / 8) * 8;
+    qint64 expectedSize = entriesOffset + entryWords * 8;
+
+    if (m_header->numberOfPositions != m_geometry.numberOfPositions() || fileSize != expectedSize)
+    {
+        close();
+        return false;
+    }
+
+    m_bitmap = reinterpret_cast<const quint64*>(m_data + bitmapOffset);
+    m_rankBlocks = reinterpret_cast<const quint32*>(m_data + rankOffset);
+    m_entries = reinterpret_cast<const quint64*>(m_data + entriesOffset);
+
+    return true;
+}
+
+void Tablebase::close()
+{
+    if (m_data)
+    {
+        m_file.unmap(const_cast<uchar*>(m_data));
+    }
+
+    m_file.close();
+
+    m_data = nullptr;
+    m_header = nullptr;
+    m_bitmap = nullptr;
+    m_rankBlocks = nullptr;
+    m_entries = nullptr;
+}
+
+bool Tablebase::isOpen() const
+{
+    return m_entries != nullptr;
+}
+
+int Tablebase::boardSize() const
+{
+    return isOpen() ? static_cast<int>(m_header->boardSize) : 0;
+}
+
+int Tablebase::lineLength() const
+{
+    return isOpen() ? static_cast<int>(m_header->lineLength) : 0;
+}
+
+TablebaseEntry Tablebase::probe(quint32 moverMask, quint32 opponentMask) const
+{
+    TablebaseEntry entry;
+    if (!isOpen() || (moverMask & opponentMask) || ((moverMask | opponentMask) & ~m_geometry.fullMask()))
+    {
+        return entry;
+    }
+
+    int symmetry = 0;
+    quint32 index = m_geometry.canonicalIndex(moverMask, opponentMask, &symmetry);
+    if (!(m_bitmap[index / 64] & (Q_UINT64_C(1) << (index % 64))))
+    {
+        return entry;
+    }
+
+    quint64 bitOffset = static_cast<quint64>(rank(m_bitmap, m_rankBlocks, index)) * KEntryBits;
+    quint64 word = bitOffset / 64;
+    int shift = static_cast<int>(bitOffset % 64);
+
+    quint64 bits = m_entries[word] >> shift;
+    if (shift + KEntryBits > 64)
+    {
+        bits |= m_entries[word + 1] << (64 - shift);
+    }
+
+    entry = unpackEntry(static_cast<quint16>(bits & ((1u << KEntryBits) - 1)));
+
+    // Best move is stored for the canonical orientation of the board.
+    if (entry.bestMove >= 0)
+    {
+        entry.bestMove = m_geometry.inverseTransformTile(entry.bestMove, symmetry);
+    }
+
+    return entry;
+}
+
+quint32 Tablebase::rank(const quint64* bitmap, const quint32* rankBlocks, quint32 index)
+{
+    quint32 word = index / 64;
+    quint32 result = rankBlocks[word / KWordsPerRankBlock];
+
+    for (quint32 i = word - word % KWordsPerRankBlock; i < word; i++)
+    {
+        result += static_cast<quint32>(qPopulationCount(bitmap[i]));
+    }
+
+    quint64 partialMask = (Q_UINT64_C(1) << (index % 64)) - 1;
+    result += static_cast<quint32>(qPopulationCount(bitmap[word] & partialMask));
+
+    return result;
+}
+
+quint16 Tablebase::packEntry(EPositionValue value, int bestMove, int distance)
+{
+    quint16 move = bestMove < 0 ? 0 : static_cast<quint16>(bestMove & 0xF);
+
+    return static_cast<quint16>((value & 0x3) | (move << 2) | ((distance & 0x1F) << 6));
+}
+
+TablebaseEntry Tablebase::unpackEntry(quint16 packedEntry)
+{
+    TablebaseEntry entry;
+    entry.value = static_cast<EPositionValue>(packedEntry & 0x3);
+    entry.distance = (packedEntry >> 6) & 0x1F;
+
+    // Terminal positions have no move to play.
+    entry.bestMove = entry.distance == 0 ? -1 : (packedEntry >> 2) & 0xF;
+
+    return entry;
+}
+
+TablebaseEntry Tablebase::moveOutcome(const TablebaseEntry& successor)
+{
+    TablebaseEntry outcome;
+    outcome.distance = successor.distance + 1;
+
+    if (successor.value == LosingPosition)
+    {
+        outcome.value = WinningPosition;
+    }
+    else if (successor.value == WinningPosition)
+    {
+        outcome.value = LosingPosition;
+    }
+    else
+    {
+        outcome.value = DrawnPosition;
+    }
+
+    return outcome;
+}
+
+bool Tablebase::combineMove(TablebaseEntry& best, int move, const TablebaseEntry& outcome)
+{
+    bool better = false;
+    if (best.value == UnknownPosition)
+    {
+        better = true;
+    }
+    else if (outcome.value == WinningPosition)
+    {
+        better = best.value != WinningPosition || outcome.distance < best.distance;
+    }
+    else if (outcome.value == DrawnPosition)
+    {
+        better = best.value == LosingPosition;
+    }
+    else
+    {
+        better = best.value == LosingPosition && outcome.distance > best.distance;
+    }
+
+    if (better)
+    {
+        best.value = outcome.value;
+        best.bestMove = move;
+        best.distance = outcome.distance;
+    }
+
+    return better;
+}
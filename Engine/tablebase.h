@@ -0,0 +1,152 @@
+#ifndef TABLEBASE_H
+#define TABLEBASE_H
+
+#include <QFile>
+#include <QString>
+
+#include "boardgeometry.h"
+#include "gameengine.h"
+
+/*!
+ * \brief The TablebaseEntry struct Solved value of a single position.
+ */
+struct TablebaseEntry
+{
+    EPositionValue value = UnknownPosition; /*!< Game theoretical value for the player to move. */
+    int bestMove = -1; /*!< Index of the best tile to play, -1 if there is no move. */
+    int distance = 0; /*!< Number of moves until the end of the round with perfect play. */
+};
+
+/*!
+ * \brief The Tablebase class Read-only access to the tablebase file generated by TablebaseGenerator.
+ *
+ * The file is memory mapped and never loaded into the heap. Positions are stored only in their canonical
+ * (symmetry-reduced) form. A bitmap over all base-3 position indexes marks stored positions and the rank
+ * of the position in that bitmap, found in constant time with help of the block rank directory,
+ * is the index of its bit-packed entry.
+ *
+ * File layout:
+ * - header (TablebaseHeader),
+ * - bitmap of stored positions (quint64 words),
+ * - rank directory with number of stored positions before each block of KWordsPerRankBlock words (quint32, padded to 8 bytes),
+ * - entries packed with KEntryBits bits each (quint64 words).
+ */
+class Tablebase
+{
+public:
+    /*!
+     * \brief The TablebaseHeader struct Header at the beginning of the tablebase file.
+     */
+    struct TablebaseHeader
+    {
+        char magic[4]; /*!< File magic, always KMagic. */
+        quint32 version; /*!< File format version. */
+        quint32 boardSize; /*!< Board size. */
+        quint32 lineLength; /*!< Winning line length. */
+        quint32 numberOfPositions; /*!< Number of base-3 position indexes covered by the bitmap. */
+        quint32 numberOfEntries; /*!< Number of stored positions. */
+        quint32 entryBits; /*!< Number of bits of a single entry. */
+        quint32 reserved; /*!< Reserved, always 0. */
+    };
+
+    static const char KMagic[4]; /*!< File magic. */
+    static const quint32 KVersion = 1; /*!< Current file format version. */
+    static const int KEntryBits = 11; /*!< Bits per entry: 2 bits of value, 4 bits of best move and 5 bits of distance. */
+    static const int KWordsPerRankBlock = 8; /*!< Number of bitmap words covered by one rank directory item. */
+
+    /*!
+     * \brief Tablebase Constructor.
+     */
+    Tablebase();
+
+    /*!
+     * \brief open Method maps the tablebase file into memory.
+     * \param filePath Path to the tablebase file.
+     * \return True if the file has been mapped and it is valid, False otherwise.
+     */
+    bool open(const QString& filePath);
+
+    /*!
+     * \brief close Method unmaps the tablebase file.
+     */
+    void close();
+
+    /*!
+     * \brief isOpen Method checks if the tablebase is available for queries.
+     * \return True if the tablebase is open, False otherwise.
+     */
+    bool isOpen() const;
+
+    /*!
+     * \brief boardSize Getter method returning board size of the tablebase.
+     * \return Board size, 0 if the tablebase is not open.
+     */
+    int boardSize() const;
+
+    /*!
+     * \brief lineLength Getter method returning winning line length of the tablebase.
+     * \return Winning line length, 0 if the tablebase is not open.
+     */
+    int lineLength() const;
+
+    /*!
+     * \brief probe Method returns the value and the best move for the given position in constant time.
+     * \param moverMask Tiles of the player to move.
+     * \param opponentMask Tiles of the opponent.
+     * \return Position entry, with UnknownPosition value if the position is not stored.
+     */
+    TablebaseEntry probe(quint32 moverMask, quint32 opponentMask) const;
+
+    /*!
+     * \brief rank Method returns number of bits set in the bitmap before the given index.
+     * \param bitmap Bitmap words.
+     * \param rankBlocks Rank directory.
+     * \param index Bit index.
+     * \return Number of set bits before the index.
+     */
+    static quint32 rank(const quint64* bitmap, const quint32* rankBlocks, quint32 index);
+
+    /*!
+     * \brief packEntry Method packs the position value, best move and distance into KEntryBits bits.
+     * \param value Position value.
+     * \param bestMove Best move tile index.
+     * \param distance Distance to the end of the round.
+     * \return Packed entry.
+     */
+    static quint16 packEntry(EPositionValue value, int bestMove, int distance);
+
+    /*!
+     * \brief unpackEntry Method unpacks the entry packed with packEntry.
+     * \param packedEntry Packed entry.
+     * \return Unpacked entry.
+     */
+    static TablebaseEntry unpackEntry(quint16 packedEntry);
+
+    /*!
+     * \brief moveOutcome Method converts entry of the position after the move into the outcome of the move for the player making it.
+     * \param successor Entry of the position after the move, from the point of view of the opponent.
+     * \return Value and distance of the move, counting the move itself.
+     */
+    static TablebaseEntry moveOutcome(const TablebaseEntry& successor);
+
+    /*!
+     * \brief combineMove Method keeps the better of the best move so far and the given move.
+     * The fastest win is preferred, then a draw and then the slowest loss.
+     * \param best Best move so far, UnknownPosition value before the first move.
+     * \param move Tile index of the move.
+     * \param outcome Value and distance of the move (see moveOutcome).
+     * \return True if the move has become the best one, False otherwise.
+     */
+    static bool combineMove(TablebaseEntry& best, int move, const TablebaseEntry& outcome);
+
+private:
+    QFile m_file; /*!< Tablebase file. */
+    const uchar* m_data; /*!< Mapped file contents, nullptr if the file is not mapped. */
+    const TablebaseHeader* m_header; /*!< Header of the mapped file. */
+    const quint64* m_bitmap; /*!< Bitmap of stored positions. */
+    const quint32* m_rankBlocks; /*!< Rank directory. */
+    const quint64* m_entries; /*!< Bit-packed entries. */
+    BoardGeometry m_geometry; /*!< Geometry of the board covered by the tablebase. */
+};
+
+#endif // TABLEBASE_H
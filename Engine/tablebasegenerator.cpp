@@ -0,0 +1,265 @@
+#include "tablebasegenerator.h"
+
+#include <QFile>
+#include <QtAlgorithms>
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "tablebase.h"
+
+TablebaseGenerator::TablebaseGenerator(int boardSize, int lineLength, int threadCount) :
+    m_geometry(boardSize, lineLength),
+    m_threadCount(threadCount)
+{
+    if (m_threadCount <= 0)
+    {
+        m_threadCount = qMax(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+}
+
+template<typename Job>
+void TablebaseGenerator::runInParallel(Job job) const
+{
+    std::vector<std::thread> workers;
+    for (int worker = 1; worker < m_threadCount; worker++)
+    {
+        workers.emplace_back(job, worker);
+    }
+
+    job(0);
+
+    for (std::thread& thread : workers)
+    {
+        thread.join();
+    }
+}
+
+bool TablebaseGenerator::generate(const QString& filePath)
+{
+    enumeratePositions();
+    buildRankDirectory();
+    solvePositions();
+
+    bool written = writeFile(filePath);
+
+    m_layers.clear();
+    m_bitmap.clear();
+    m_rankBlocks.clear();
+
+    return written;
+}
+
+quint32 TablebaseGenerator::numberOfEntries() const
+{
+    return static_cast<quint32>(m_entries.size());
+}
+
+void TablebaseGenerator::enumeratePositions()
+{
+    m_layers.clear();
+    m_layers.resize(m_geometry.numberOfTiles() + 1);
+    m_layers[0].append(m_geometry.canonicalIndex(0, 0));
+
+    for (int layer = 0; layer < m_geometry.numberOfTiles(); layer++)
+    {
+        const QVector<quint32>& positions = m_layers[layer];
+        std::vector<std::vector<quint32>> successors(m_threadCount);
+
+        runInParallel([&](int worker)
+        {
+            for (int i = worker; i < positions.size(); i += m_threadCount)
+            {
+                quint32 moverMask = 0;
+                quint32 opponentMask = 0;
+                m_geometry.positionMasks(positions.at(i), moverMask, opponentMask);
+
+                // Round is already finished if the opponent has completed a line with the last move.
+                if (m_geometry.hasCompletedLine(opponentMask))
+                {
+                    continue;
+                }
+
+                quint32 emptyMask = m_geometry.fullMask() & ~(moverMask | opponentMask);
+                for (int tileIndex = 0; tileIndex < m_geometry.numberOfTiles(); tileIndex++)
+                {
+                    if (emptyMask & (1u << tileIndex))
+                    {
+                        // After the move players swap their roles.
+                        successors[worker].push_back(m_geometry.canonicalIndex(opponentMask, moverMask | (1u << tileIndex)));
+                    }
+                }
+            }
+        });
+
+        std::vector<quint32> nextLayer;
+        for (const std::vector<quint32>& workerSuccessors : successors)
+        {
+            nextLayer.insert(nextLayer.end(), workerSuccessors.begin(), workerSuccessors.end());
+        }
+        successors.clear();
+
+        std::sort(nextLayer.begin(), nextLayer.end());
+        nextLayer.erase(std::unique(nextLayer.begin(), nextLayer.end()), nextLayer.end());
+
+        m_layers[layer + 1].reserve(static_cast<int>(nextLayer.size()));
+        for (quint32 index : nextLayer)
+        {
+            m_layers[layer + 1].append(index);
+        }
+    }
+
+    int bitmapWords = static_cast<int>((static_cast<quint64>(m_geometry.numberOfPositions()) + 63) / 64);
+    m_bitmap.fill(0, bitmapWords);
+
+    for (const QVector<quint32>& positions : m_layers)
+    {
+        for (quint32 index : positions)
+        {
+            m_bitmap[index / 64] |= Q_UINT64_C(1) << (index % 64);
+        }
+    }
+}
+
+void TablebaseGenerator::buildRankDirectory()
+{
+    int rankBlocks = (m_bitmap.size() + Tablebase::KWordsPerRankBlock - 1) / Tablebase::KWordsPerRankBlock;
+    m_rankBlocks.fill(0, rankBlocks);
+
+    quint32 rank = 0;
+    for (int word = 0; word < m_bitmap.size(); word++)
+    {
+        if (word % Tablebase::KWordsPerRankBlock == 0)
+        {
+            m_rankBlocks[word / Tablebase::KWordsPerRankBlock] = rank;
+        }
+        rank += static_cast<quint32>(qPopulationCount(m_bitmap.at(word)));
+    }
+
+    m_entries.fill(0, static_cast<int>(rank));
+}
+
+void TablebaseGenerator::solvePositions()
+{
+    quint16* entries = m_entries.data();
+    const quint64* bitmap = m_bitmap.constData();
+    const quint32* rankBlocks = m_rankBlocks.constData();
+
+    // Successors of the layer are always in the next layer, so layers are solved from the full board backwards.
+    for (int layer = m_geometry.numberOfTiles(); layer >= 0; layer--)
+    {
+        const QVector<quint32>& positions = m_layers.at(layer);
+
+        runInParallel([&](int worker)
+        {
+            for (int i = worker; i < positions.size(); i += m_threadCount)
+            {
+                quint32 index = positions.at(i);
+                entries[Tablebase::rank(bitmap, rankBlocks, index)] = solvePosition(index);
+            }
+        });
+
+        // Positions of the layer are not needed anymore.
+        m_layers[layer].clear();
+        m_layers[layer].squeeze();
+    }
+}
+
+quint16 TablebaseGenerator::solvePosition(quint32 index) const
+{
+    quint32 moverMask = 0;
+    quint32 opponentMask = 0;
+    m_geometry.positionMasks(index, moverMask, opponentMask);
+
+    if (m_geometry.hasCompletedLine(opponentMask))
+    {
+        return Tablebase::packEntry(LosingPosition, -1, 0);
+    }
+
+    quint32 emptyMask = m_geometry.fullMask() & ~(moverMask | opponentMask);
+    if (emptyMask == 0)
+    {
+        return Tablebase::packEntry(DrawnPosition, -1, 0);
+    }
+
+    TablebaseEntry best;
+
+    for (int tileIndex = 0; tileIndex < m_geometry.numberOfTiles(); tileIndex++)
+    {
+        if (!(emptyMask & (1u << tileIndex)))
+        {
+            continue;
+        }
+
+        quint32 newMoverMask = moverMask | (1u << tileIndex);
+        TablebaseEntry outcome;
+        outcome.value = WinningPosition;
+        outcome.distance = 1;
+
+        if (!m_geometry.completesLine(newMoverMask, tileIndex))
+        {
+            outcome = Tablebase::moveOutcome(Tablebase::unpackEntry(entryAt(m_geometry.canonicalIndex(opponentMask, newMoverMask))));
+        }
+
+        Tablebase::combineMove(best, tileIndex, outcome);
+    }
+
+    return Tablebase::packEntry(best.value, best.bestMove, best.distance);
+}
+
+quint16 TablebaseGenerator::entryAt(quint32 index) const
+{
+    return m_entries.at(static_cast<int>(Tablebase::rank(m_bitmap.constData(), m_rankBlocks.constData(), index)));
+}
+
+bool TablebaseGenerator::writeFile(const QString& filePath) const
+{
+    QFile file(filePath);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    {
+        return false;
+    }
+
+    Tablebase::TablebaseHeader header;
+    memcpy(header.magic, Tablebase::KMagic, sizeof(header.magic));
+    header.version = Tablebase::KVersion;
+    header.boardSize = static_cast<quint32>(m_geometry.boardSize());
+    header.lineLength = static_cast<quint32>(m_geometry.lineLength());
+    header.numberOfPositions = m_geometry.numberOfPositions();
+    header.numberOfEntries = static_cast<quint32>(m_entries.size());
+    header.entryBits = Tablebase::KEntryBits;
+    header.reserved = 0;
+
+    // Rank directory is padded to keep the entries aligned to 8 bytes.
+    QVector<quint32> rankBlocks = m_rankBlocks;
+    if (rankBlocks.size() % 2)
+    {
+        rankBlocks.append(0);
+    }
+
+    // One additional word allows reading entries which cross the word boundary without bounds checks.
+    int entryWords = static_cast<int>((static_cast<quint64>(m_entries.size()) * Tablebase::KEntryBits + 63) / 64) + 1;
+    QVector<quint64> packedEntries(entryWords, 0);
+    for (int i = 0; i < m_entries.size(); i++)
+    {
+        quint64 bitOffset = static_cast<quint64>(i) * Tablebase::KEntryBits;
+        int word = static_cast<int>(bitOffset / 64);
+        int shift = static_cast<int>(bitOffset % 64);
+
+        packedEntries[word] |= static_cast<quint64>(m_entries.at(i)) << shift;
+        if (shift + Tablebase::KEntryBits > 64)
+        {
+            packedEntries[word + 1] |= static_cast<quint64>(m_entries.at(i)) >> (64 - shift);
+        }
+    }
+
+    bool written = file.write(reinterpret_cast<const char*>(&header), sizeof(header)) == sizeof(header)
+            && file.write(reinterpret_cast<const char*>(m_bitmap.constData()), m_bitmap.size() * 8) == m_bitmap.size() * 8
+            && file.write(reinterpret_cast<const char*>(rankBlocks.constData()), rankBlocks.size() * 4) == rankBlocks.size() * 4
+            && file.write(reinterpret_cast<const char*>(packedEntries.constData()), packedEntries.size() * 8) == packedEntries.size() * 8;
+
+    file.close();
+
+    return written;
+}
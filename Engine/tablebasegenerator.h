@@ -0,0 +1,96 @@
+#ifndef TABLEBASEGENERATOR_H
+#define TABLEBASEGENERATOR_H
+
+#include <QString>
+#include <QVector>
+
+#include "boardgeometry.h"
+
+/*!
+ * \brief The TablebaseGenerator class Class solving every reachable position of the board by retrograde analysis.
+ *
+ * Positions are described from the point of view of the player to move, so one tablebase serves both players
+ * regardless of who has started the round. The generation runs in two passes:
+ * - forward pass enumerates reachable canonical positions layer by layer (by number of tiles on the board),
+ * - retrograde pass solves the layers from the full board back to the empty board, so every position
+ *   is solved once all of its successors are known.
+ * Positions of a single layer are independent and they are processed in parallel. Memory use is bounded by the
+ * position bitmap and one 16-bit entry per stored position, the bit-packed file is written at the end.
+ */
+class TablebaseGenerator
+{
+public:
+    /*!
+     * \brief TablebaseGenerator Constructor.
+     * \param boardSize Size of the board (up to BoardGeometry::KMaxBoardSize).
+     * \param lineLength Number of tiles of the same type in a row needed to win.
+     * \param threadCount Number of worker threads, 0 to use the number of available cores.
+     */
+    TablebaseGenerator(int boardSize, int lineLength, int threadCount = 0);
+
+    /*!
+     * \brief generate Method solves all reachable positions and writes the tablebase file.
+     * \param filePath Path to the output file.
+     * \return True if the file has been written, False otherwise.
+     */
+    bool generate(const QString& filePath);
+
+    /*!
+     * \brief numberOfEntries Getter method returning number of positions solved by the last generation.
+     * \return Number of solved positions.
+     */
+    quint32 numberOfEntries() const;
+
+private:
+    BoardGeometry m_geometry; /*!< Geometry of the solved board. */
+    int m_threadCount; /*!< Number of worker threads. */
+    QVector<QVector<quint32>> m_layers; /*!< Canonical position indexes grouped by number of tiles on the board. */
+    QVector<quint64> m_bitmap; /*!< Bitmap of stored positions. */
+    QVector<quint32> m_rankBlocks; /*!< Rank directory of the bitmap. */
+    QVector<quint16> m_entries; /*!< Solved entries in the order of position indexes. */
+
+    /*!
+     * \brief enumeratePositions Method performs forward pass and fills the layers and the position bitmap.
+     */
+    void enumeratePositions();
+
+    /*!
+     * \brief buildRankDirectory Method computes the rank directory of the position bitmap.
+     */
+    void buildRankDirectory();
+
+    /*!
+     * \brief solvePositions Method performs retrograde pass and fills the entries.
+     */
+    void solvePositions();
+
+    /*!
+     * \brief solvePosition Method solves a single position using already solved successors.
+     * \param index Canonical position index.
+     * \return Packed entry of the position.
+     */
+    quint16 solvePosition(quint32 index) const;
+
+    /*!
+     * \brief entryAt Method returns already solved entry of the canonical position.
+     * \param index Canonical position index.
+     * \return Packed entry.
+     */
+    quint16 entryAt(quint32 index) const;
+
+    /*!
+     * \brief writeFile Method writes header, bitmap, rank directory and bit-packed entries to the file.
+     * \param filePath Path to the output file.
+     * \return True if the file has been written, False otherwise.
+     */
+    bool writeFile(const QString& filePath) const;
+
+    /*!
+     * \brief runInParallel Method runs the job on all worker threads and waits for their completion.
+     * \param job Function called with the worker index in range [0, m_threadCount).
+     */
+    template<typename Job>
+    void runInParallel(Job job) const;
+};
+
+#endif // TABLEBASEGENERATOR_H
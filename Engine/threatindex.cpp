@@ -0,0 +1,242 @@
+#include "threatindex.h"
+
+namespace {
+
+const int KDirectionSteps[ThreatIndex::KNumberOfDirections][2] = {
+    { 1, 0 },   // HorizontalLine
+    { 0, 1 },   // VerticalLine
+    { 1, 1 },   // DownDiagonalLine
+    { -1, 1 }   // UpDiagonalLine
+};
+
+const int KNumberOfRunEnds = 3;
+
+}
+
+const int ThreatIndex::KNoThreat;
+
+ThreatIndex::ThreatIndex(int boardSize, int lineLength) :
+    m_boardSize(qMax(1, boardSize)),
+    m_lineLength(qBound(1, lineLength, qMax(1, boardSize))),
+    m_numberOfTiles(m_boardSize * m_boardSize)
+{
+    m_tiles.resize(m_numberOfTiles);
+    m_runs.resize(KNumberOfDirections * m_numberOfTiles);
+    m_runStarts.resize(KNumberOfDirections * m_numberOfTiles);
+    m_classHeads.resize(2 * m_lineLength * KNumberOfRunEnds);
+    m_classCounts.resize(2 * m_lineLength * KNumberOfRunEnds);
+
+    clear();
+}
+
+void ThreatIndex::clear()
+{
+    m_tiles.fill(-1);
+    m_runStarts.fill(-1);
+    m_classHeads.fill(KNoThreat);
+    m_classCounts.fill(0);
+
+    for (Run& run : m_runs)
+    {
+        run.player = -1;
+    }
+}
+
+void ThreatIndex::placeTile(int index, EPlayerType player)
+{
+    if (index < 0 || index >= m_numberOfTiles || m_tiles.at(index) != -1)
+    {
+        return;
+    }
+
+    m_tiles[index] = player;
+
+    for (int direction = 0; direction < KNumberOfDirections; direction++)
+    {
+        int offset = direction * m_numberOfTiles;
+        int before = step(index, direction, -1);
+        int after = step(index, direction, 1);
+        int startIndex = index;
+        int endIndex = index;
+
+        // Own run ending just before the tile is extended, opponent's run loses its open end.
+        if (before >= 0 && m_tiles.at(before) != -1)
+        {
+            int handle = offset + m_runStarts.at(offset + before);
+            if (m_tiles.at(before) == player)
+            {
+                startIndex = handle - offset;
+                removeRun(handle);
+            }
+            else
+            {
+                unlinkRun(handle);
+                m_runs[handle].ends--;
+                linkRun(handle);
+            }
+        }
+
+        // Same for the run starting just after the tile.
+        if (after >= 0 && m_tiles.at(after) != -1)
+        {
+            int handle = offset + after;
+            if (m_tiles.at(after) == player)
+            {
+                endIndex = m_runs.at(handle).endIndex;
+                removeRun(handle);
+            }
+            else
+            {
+                unlinkRun(handle);
+                m_runs[handle].ends--;
+                linkRun(handle);
+            }
+        }
+
+        addRun(direction, startIndex, endIndex, player);
+    }
+}
+
+int ThreatIndex::threatCount(EPlayerType player, int length, ERunEnds ends) const
+{
+    if (length < 1 || player < PlayerO || player > PlayerX || ends < ClosedRun || ends > OpenRun)
+    {
+        return 0;
+    }
+
+    return m_classCounts.at(classIndex(player, length, ends));
+}
+
+int ThreatIndex::firstThreat(EPlayerType player, int length, ERunEnds ends) const
+{
+    if (length < 1 || player < PlayerO || player > PlayerX || ends < ClosedRun || ends > OpenRun)
+    {
+        return KNoThreat;
+    }
+
+    return m_classHeads.at(classIndex(player, length, ends));
+}
+
+int ThreatIndex::nextThreat(int handle) const
+{
+    return m_runs.at(handle).next;
+}
+
+Threat ThreatIndex::threat(int handle) const
+{
+    const Run& run = m_runs.at(handle);
+
+    Threat result;
+    result.direction = static_cast<ELineType>(handle / m_numberOfTiles);
+    result.startIndex = handle % m_numberOfTiles;
+    result.endIndex = run.endIndex;
+    result.length = run.length;
+    result.player = static_cast<EPlayerType>(run.player);
+    result.ends = static_cast<ERunEnds>(run.ends);
+
+    return result;
+}
+
+int ThreatIndex::threatAt(ELineType direction, int startIndex) const
+{
+    if (startIndex < 0 || startIndex >= m_numberOfTiles)
+    {
+        return KNoThreat;
+    }
+
+    int handle = direction * m_numberOfTiles + startIndex;
+
+    return m_runs.at(handle).player == -1 ? KNoThreat : handle;
+}
+
+int ThreatIndex::classIndex(int player, int length, int ends) const
+{
+    return (player * m_lineLength + qMin(length, m_lineLength) - 1) * KNumberOfRunEnds + ends;
+}
+
+int ThreatIndex::step(int index, int direction, int steps) const
+{
+    int x = index % m_boardSize + KDirectionSteps[direction][0] * steps;
+    int y = index / m_boardSize + KDirectionSteps[direction][1] * steps;
+
+    if (x < 0 || x >= m_boardSize || y < 0 || y >= m_boardSize)
+    {
+        return -1;
+    }
+
+    return y * m_boardSize + x;
+}
+
+bool ThreatIndex::isEmptyTile(int index) const
+{
+    return index >= 0 && m_tiles.at(index) == -1;
+}
+
+void ThreatIndex::addRun(int direction, int startIndex, int endIndex, int player)
+{
+    int offset = direction * m_numberOfTiles;
+    int handle = offset + startIndex;
+    Run& run = m_runs[handle];
+
+    run.endIndex = endIndex;
+    run.player = player;
+    run.ends = (isEmptyTile(step(startIndex, direction, -1)) ? 1 : 0) + (isEmptyTile(step(endIndex, direction, 1)) ? 1 : 0);
+
+    // Horizontal runs are measured in columns, the remaining directions in rows.
+    if (direction == HorizontalLine)
+    {
+        run.length = endIndex - startIndex + 1;
+    }
+    else
+    {
+        run.length = endIndex / m_boardSize - startIndex / m_boardSize + 1;
+    }
+
+    m_runStarts[offset + endIndex] = startIndex;
+    linkRun(handle);
+}
+
+void ThreatIndex::removeRun(int handle)
+{
+    unlinkRun(handle);
+    m_runs[handle].player = -1;
+}
+
+void ThreatIndex::linkRun(int handle)
+{
+    Run& run = m_runs[handle];
+    int runClass = classIndex(run.player, run.length, run.ends);
+    int head = m_classHeads.at(runClass);
+
+    run.previous = KNoThreat;
+    run.next = head;
+    if (head != KNoThreat)
+    {
+        m_runs[head].previous = handle;
+    }
+
+    m_classHeads[runClass] = handle;
+    m_classCounts[runClass]++;
+}
+
+void ThreatIndex::unlinkRun(int handle)
+{
+    Run& run = m_runs[handle];
+    int runClass = classIndex(run.player, run.length, run.ends);
+
+    if (run.previous != KNoThreat)
+    {
+        m_runs[run.previous].next = run.next;
+    }
+    else
+    {
+        m_classHeads[runClass] = run.next;
+    }
+
+    if (run.next != KNoThreat)
+    {
+        m_runs[run.next].previous = run.previous;
+    }
+
+    m_classCounts[runClass]--;
+}
@@ -0,0 +1,174 @@
+#ifndef THREATINDEX_H
+#define THREATINDEX_H
+
+#include <QVector>
+
+#include "gameengine.h"
+
+/*!
+ * \brief The Threat struct Run of consecutive tiles of the same type along one of the line directions.
+ */
+struct Threat
+{
+    ELineType direction = HorizontalLine; /*!< Direction of the run. */
+    int startIndex = -1; /*!< Index of the first tile of the run. */
+    int endIndex = -1; /*!< Index of the last tile of the run. */
+    int length = 0; /*!< Number of tiles in the run. */
+    EPlayerType player = PlayerX; /*!< Owner of the tiles. */
+    ERunEnds ends = ClosedRun; /*!< Number of empty tiles directly before and after the run. */
+};
+
+/*!
+ * \brief The ThreatIndex class Incrementally updated index of runs of tiles on k-in-a-row boards of any size.
+ *
+ * Every maximal run of consecutive tiles of one player is stored once per direction and keyed by the direction and
+ * its first tile (horizontal runs go left to right, vertical and down diagonal runs top to bottom, up diagonal runs
+ * from top right to bottom left). Runs are classified by owner, length (runs of line length and longer share
+ * the last class) and number of open ends. Each class keeps its count and an intrusive list of its runs, so the count
+ * is available in O(1) and threats of the class are listed in O(1) per threat.
+ *
+ * Placing a tile touches only the runs ending directly next to it in each of four directions, so the update costs
+ * O(1) regardless of the board size. Runs with gaps (e.g. X_XX) are not detected.
+ */
+class ThreatIndex
+{
+public:
+    static const int KNumberOfDirections = 4; /*!< Number of line directions (ELineType values). */
+    static const int KNoThreat = -1; /*!< Handle returned when there are no more threats in the class. */
+
+    /*!
+     * \brief ThreatIndex Constructor creating index for an empty board.
+     * \param boardSize Number of tiles in a row of the board.
+     * \param lineLength Number of tiles of the same type in a row needed to win.
+     */
+    ThreatIndex(int boardSize, int lineLength);
+
+    /*!
+     * \brief clear Method removes all runs from the index.
+     */
+    void clear();
+
+    /*!
+     * \brief placeTile Method updates the runs affected by the new tile. Tiles out of the board and occupied tiles are ignored.
+     * \param index Index of the tile.
+     * \param player Owner of the tile.
+     */
+    void placeTile(int index, EPlayerType player);
+
+    /*!
+     * \brief threatCount Method returns number of runs of the given class.
+     * \param player Owner of the runs.
+     * \param length Length of the runs. Lengths equal or greater than the line length are counted together.
+     * \param ends Number of open ends of the runs.
+     * \return Number of runs.
+     */
+    int threatCount(EPlayerType player, int length, ERunEnds ends) const;
+
+    /*!
+     * \brief firstThreat Method returns handle of the first run of the given class.
+     * \param player Owner of the runs.
+     * \param length Length of the runs.
+     * \param ends Number of open ends of the runs.
+     * \return Threat handle, KNoThreat if the class is empty.
+     */
+    int firstThreat(EPlayerType player, int length, ERunEnds ends) const;
+
+    /*!
+     * \brief nextThreat Method returns handle of the next run of the same class.
+     * \param handle Current threat handle.
+     * \return Next threat handle, KNoThreat if there are no more runs.
+     */
+    int nextThreat(int handle) const;
+
+    /*!
+     * \brief threat Method returns the run of the given handle.
+     * \param handle Threat handle.
+     * \return Threat description.
+     */
+    Threat threat(int handle) const;
+
+    /*!
+     * \brief threatAt Method returns handle of the run starting at the given tile in the given direction.
+     * \param direction Direction of the run.
+     * \param startIndex Index of the first tile of the run.
+     * \return Threat handle, KNoThreat if no run starts there.
+     */
+    int threatAt(ELineType direction, int startIndex) const;
+
+private:
+    /*!
+     * \brief The Run struct Stored run, located at its handle (direction * number of tiles + first tile).
+     */
+    struct Run
+    {
+        int endIndex; /*!< Index of the last tile. */
+        int length; /*!< Number of tiles. */
+        int player; /*!< Owner of the tiles, -1 if there is no run starting at this tile. */
+        int ends; /*!< Number of open ends. */
+        int previous; /*!< Previous run of the same class. */
+        int next; /*!< Next run of the same class. */
+    };
+
+    int m_boardSize; /*!< Number of tiles in a row. */
+    int m_lineLength; /*!< Winning line length. */
+    int m_numberOfTiles; /*!< Number of tiles of the board. */
+    QVector<int> m_tiles; /*!< Owner of each tile, -1 for empty tiles. */
+    QVector<Run> m_runs; /*!< Runs indexed by handle. */
+    QVector<int> m_runStarts; /*!< First tile of the run for the last tile of each run, indexed like runs. */
+    QVector<int> m_classHeads; /*!< First run of each class. */
+    QVector<int> m_classCounts; /*!< Number of runs of each class. */
+
+    /*!
+     * \brief classIndex Method returns index of the class of runs.
+     * \param player Owner of the runs.
+     * \param length Length of the runs.
+     * \param ends Number of open ends.
+     * \return Class index.
+     */
+    int classIndex(int player, int length, int ends) const;
+
+    /*!
+     * \brief step Method moves the tile by the given number of steps in the direction.
+     * \param index Tile index.
+     * \param direction Direction of the move.
+     * \param steps Number of steps, negative values move backwards.
+     * \return Index of the tile, -1 if it is out of the board.
+     */
+    int step(int index, int direction, int steps) const;
+
+    /*!
+     * \brief isEmptyTile Method checks if the tile is on the board and empty.
+     * \param index Tile index, may be -1.
+     * \return True if the tile is empty, False otherwise.
+     */
+    bool isEmptyTile(int index) const;
+
+    /*!
+     * \brief addRun Method stores the run and links it to its class.
+     * \param direction Direction of the run.
+     * \param startIndex First tile.
+     * \param endIndex Last tile.
+     * \param player Owner of the tiles.
+     */
+    void addRun(int direction, int startIndex, int endIndex, int player);
+
+    /*!
+     * \brief removeRun Method unlinks the run from its class and removes it.
+     * \param handle Threat handle.
+     */
+    void removeRun(int handle);
+
+    /*!
+     * \brief linkRun Method adds the run to the list of its class.
+     * \param handle Threat handle.
+     */
+    void linkRun(int handle);
+
+    /*!
+     * \brief unlinkRun Method removes the run from the list of its class.
+     * \param handle Threat handle.
+     */
+    void unlinkRun(int handle);
+};
+
+#endif // THREATINDEX_H
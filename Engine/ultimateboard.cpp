@@ -0,0 +1,242 @@
+#include "ultimateboard.h"
+
+#include <QtAlgorithms>
+
+namespace {
+
+/*!
+ * \brief The BoardTables struct Lookup tables shared by all boards, computed once.
+ */
+struct BoardTables
+{
+    bool winningMasks[UltimateBoard::KFullMask + 1]; /*!< True for each 9-bit mask containing complete line. */
+    qint8 tileToCell[UltimateBoard::KNumberOfTiles]; /*!< Conversion of tile indexes to cell indexes. */
+    qint8 cellToTile[UltimateBoard::KNumberOfTiles]; /*!< Conversion of cell indexes to tile indexes. */
+
+    BoardTables()
+    {
+        static const quint16 KLines[] = { 0x007, 0x038, 0x1C0, 0x049, 0x092, 0x124, 0x111, 0x054 };
+
+        for (int mask = 0; mask <= UltimateBoard::KFullMask; mask++)
+        {
+            winningMasks[mask] = false;
+            for (quint16 line : KLines)
+            {
+                if ((mask & line) == line)
+                {
+                    winningMasks[mask] = true;
+                    break;
+                }
+            }
+        }
+
+        for (int tileIndex = 0; tileIndex < UltimateBoard::KNumberOfTiles; tileIndex++)
+        {
+            int row = tileIndex / UltimateBoard::KBoardSize;
+            int column = tileIndex % UltimateBoard::KBoardSize;
+            int subBoard = (row / UltimateBoard::KSubBoardSize) * UltimateBoard::KSubBoardSize + column / UltimateBoard::KSubBoardSize;
+            int subTile = (row % UltimateBoard::KSubBoardSize) * UltimateBoard::KSubBoardSize + column % UltimateBoard::KSubBoardSize;
+            int cell = subBoard * UltimateBoard::KNumberOfSubBoards + subTile;
+
+            tileToCell[tileIndex] = static_cast<qint8>(cell);
+            cellToTile[cell] = static_cast<qint8>(tileIndex);
+        }
+    }
+};
+
+const BoardTables KTables;
+
+}
+
+UltimateBoard::UltimateBoard()
+{
+    reset(EPlayerType::PlayerX);
+}
+
+void UltimateBoard::reset(EPlayerType firstPlayer)
+{
+    for (int subBoard = 0; subBoard < KNumberOfSubBoards; subBoard++)
+    {
+        m_tiles[PlayerO][subBoard] = 0;
+        m_tiles[PlayerX][subBoard] = 0;
+    }
+
+    m_wonSubBoards[PlayerO] = 0;
+    m_wonSubBoards[PlayerX] = 0;
+    m_closedSubBoards = 0;
+    m_targetSubBoard = KAnySubBoard;
+    m_sideToMove = static_cast<quint8>(firstPlayer);
+    m_roundStatus = static_cast<quint8>(ERoundStatus::NotFinished);
+}
+
+int UltimateBoard::tileToCell(int tileIndex)
+{
+    if (tileIndex < 0 || tileIndex >= KNumberOfTiles)
+    {
+        return -1;
+    }
+
+    return KTables.tileToCell[tileIndex];
+}
+
+int UltimateBoard::cellToTile(int cell)
+{
+    return KTables.cellToTile[cell];
+}
+
+bool UltimateBoard::isWinningMask(quint16 mask)
+{
+    return KTables.winningMasks[mask & KFullMask];
+}
+
+EPlayerType UltimateBoard::sideToMove() const
+{
+    return static_cast<EPlayerType>(m_sideToMove);
+}
+
+ERoundStatus UltimateBoard::roundStatus() const
+{
+    return static_cast<ERoundStatus>(m_roundStatus);
+}
+
+int UltimateBoard::targetSubBoard() const
+{
+    return m_targetSubBoard;
+}
+
+quint16 UltimateBoard::playableSubBoards() const
+{
+    if (m_roundStatus != ERoundStatus::NotFinished)
+    {
+        return 0;
+    }
+
+    if (m_targetSubBoard != KAnySubBoard)
+    {
+        return static_cast<quint16>(1u << m_targetSubBoard);
+    }
+
+    return static_cast<quint16>(~m_closedSubBoards & KFullMask);
+}
+
+quint16 UltimateBoard::legalMoveMask(int subBoard) const
+{
+    if (!(playableSubBoards() & (1u << subBoard)))
+    {
+        return 0;
+    }
+
+    return static_cast<quint16>(~(m_tiles[PlayerO][subBoard] | m_tiles[PlayerX][subBoard]) & KFullMask);
+}
+
+bool UltimateBoard::isLegalMove(int cell) const
+{
+    if (cell < 0 || cell >= KNumberOfTiles)
+    {
+        return false;
+    }
+
+    return legalMoveMask(cell / KNumberOfSubBoards) & (1u << (cell % KNumberOfSubBoards));
+}
+
+int UltimateBoard::legalMoves(int* cells) const
+{
+    int count = 0;
+    quint16 subBoards = playableSubBoards();
+
+    while (subBoards)
+    {
+        int subBoard = qCountTrailingZeroBits(subBoards);
+        subBoards &= subBoards - 1;
+
+        quint16 tiles = static_cast<quint16>(~(m_tiles[PlayerO][subBoard] | m_tiles[PlayerX][subBoard]) & KFullMask);
+        while (tiles)
+        {
+            cells[count++] = subBoard * KNumberOfSubBoards + qCountTrailingZeroBits(tiles);
+            tiles &= tiles - 1;
+        }
+    }
+
+    return count;
+}
+
+ETileState UltimateBoard::tileState(int cell) const
+{
+    quint16 tileBit = static_cast<quint16>(1u << (cell % KNumberOfSubBoards));
+    int subBoard = cell / KNumberOfSubBoards;
+
+    if (m_tiles[PlayerO][subBoard] & tileBit)
+    {
+        return ETileState::Nought;
+    }
+    if (m_tiles[PlayerX][subBoard] & tileBit)
+    {
+        return ETileState::Cross;
+    }
+
+    return ETileState::Empty;
+}
+
+quint16 UltimateBoard::subBoardTiles(EPlayerType player, int subBoard) const
+{
+    return m_tiles[player][subBoard];
+}
+
+quint16 UltimateBoard::wonSubBoards(EPlayerType player) const
+{
+    return m_wonSubBoards[player];
+}
+
+UltimateBoard::UndoInfo UltimateBoard::makeMove(int cell)
+{
+    int subBoard = cell / KNumberOfSubBoards;
+    int subTile = cell % KNumberOfSubBoards;
+    int side = m_sideToMove;
+
+    UndoInfo undoInfo;
+    undoInfo.targetSubBoard = m_targetSubBoard;
+    undoInfo.roundStatus = m_roundStatus;
+    undoInfo.closedSubBoards = m_closedSubBoards;
+    undoInfo.wonSubBoards = m_wonSubBoards[side];
+
+    quint16 tiles = m_tiles[side][subBoard] | static_cast<quint16>(1u << subTile);
+    m_tiles[side][subBoard] = tiles;
+
+    // Only the sub-board of the move can change its state, and only the moving player can win it.
+    if (KTables.winningMasks[tiles])
+    {
+        m_wonSubBoards[side] |= static_cast<quint16>(1u << subBoard);
+        m_closedSubBoards |= static_cast<quint16>(1u << subBoard);
+
+        if (KTables.winningMasks[m_wonSubBoards[side]])
+        {
+            m_roundStatus = static_cast<quint8>(ERoundStatus::FinishedWin);
+        }
+    }
+    else if ((tiles | m_tiles[side ^ 1][subBoard]) == KFullMask)
+    {
+        m_closedSubBoards |= static_cast<quint16>(1u << subBoard);
+    }
+
+    if (m_roundStatus == ERoundStatus::NotFinished && m_closedSubBoards == KFullMask)
+    {
+        m_roundStatus = static_cast<quint8>(ERoundStatus::FinishedDraw);
+    }
+
+    m_targetSubBoard = (m_closedSubBoards & (1u << subTile)) ? static_cast<qint8>(KAnySubBoard) : static_cast<qint8>(subTile);
+    m_sideToMove = static_cast<quint8>(side ^ 1);
+
+    return undoInfo;
+}
+
+void UltimateBoard::undoMove(int cell, const UndoInfo& undoInfo)
+{
+    int side = m_sideToMove ^ 1;
+
+    m_tiles[side][cell / KNumberOfSubBoards] &= static_cast<quint16>(~(1u << (cell % KNumberOfSubBoards)));
+    m_wonSubBoards[side] = undoInfo.wonSubBoards;
+    m_closedSubBoards = undoInfo.closedSubBoards;
+    m_targetSubBoard = undoInfo.targetSubBoard;
+    m_roundStatus = undoInfo.roundStatus;
+    m_sideToMove = static_cast<quint8>(side);
+}
@@ -0,0 +1,162 @@
+#ifndef ULTIMATEBOARD_H
+#define ULTIMATEBOARD_H
+
+#include <QtGlobal>
+
+#include "gameengine.h"
+
+/*!
+ * \brief The UltimateBoard class Bitboard state of the ultimate noughts and crosses game (3x3 board of 3x3 sub-boards).
+ *
+ * Tiles of each player are stored as 9-bit masks per sub-board. Cells are numbered sub-board by sub-board
+ * (cell = subBoard * 9 + tile within the sub-board), tile indexes of the whole 9x9 board use the same row-major
+ * order as the Engine. Move to the tile sends the opponent to the sub-board with the same index as the tile.
+ * When that sub-board is won or full the opponent may play in any open sub-board.
+ *
+ * The board is a small value type: search and playouts can copy it before the move (copy-make) or use
+ * makeMove/undoMove pair. Sub-board completion is tracked incrementally on each move and feeds the meta-board masks.
+ */
+class UltimateBoard
+{
+public:
+    static const int KSubBoardSize = 3; /*!< Number of tiles in a row of the sub-board. */
+    static const int KNumberOfSubBoards = KSubBoardSize * KSubBoardSize; /*!< Number of sub-boards. */
+    static const int KBoardSize = KSubBoardSize * KSubBoardSize; /*!< Number of tiles in a row of the whole board. */
+    static const int KNumberOfTiles = KBoardSize * KBoardSize; /*!< Total number of tiles on the whole board. */
+    static const int KAnySubBoard = -1; /*!< Target value meaning that any open sub-board can be played. */
+    static const quint16 KFullMask = 0x1FF; /*!< Mask of all tiles of the sub-board (or all sub-boards of the meta-board). */
+
+    /*!
+     * \brief The UndoInfo struct State needed for reverting the move with undoMove.
+     */
+    struct UndoInfo
+    {
+        qint8 targetSubBoard; /*!< Target sub-board before the move. */
+        quint8 roundStatus; /*!< Round status before the move. */
+        quint16 closedSubBoards; /*!< Closed sub-boards before the move. */
+        quint16 wonSubBoards; /*!< Sub-boards won by the moving player before the move. */
+    };
+
+    /*!
+     * \brief UltimateBoard Constructor creating empty board with PlayerX to move.
+     */
+    UltimateBoard();
+
+    /*!
+     * \brief reset Method clears the board.
+     * \param firstPlayer Player making the first move.
+     */
+    void reset(EPlayerType firstPlayer);
+
+    /*!
+     * \brief tileToCell Method converts row-major tile index of the 9x9 board to the cell index.
+     * \param tileIndex Tile index.
+     * \return Cell index, -1 if the tile index is out of range.
+     */
+    static int tileToCell(int tileIndex);
+
+    /*!
+     * \brief cellToTile Method converts cell index to row-major tile index of the 9x9 board.
+     * \param cell Cell index.
+     * \return Tile index.
+     */
+    static int cellToTile(int cell);
+
+    /*!
+     * \brief isWinningMask Method checks if the 9-bit mask contains complete line of the 3x3 board.
+     * \param mask Mask of the tiles.
+     * \return True if the mask contains a line, False otherwise.
+     */
+    static bool isWinningMask(quint16 mask);
+
+    /*!
+     * \brief sideToMove Getter method returning player to move.
+     * \return Player to move.
+     */
+    EPlayerType sideToMove() const;
+
+    /*!
+     * \brief roundStatus Getter method returning status of the game.
+     * \return Round status.
+     */
+    ERoundStatus roundStatus() const;
+
+    /*!
+     * \brief targetSubBoard Getter method returning sub-board the player to move was sent to.
+     * \return Sub-board index or KAnySubBoard.
+     */
+    int targetSubBoard() const;
+
+    /*!
+     * \brief playableSubBoards Method returns mask of the sub-boards the player to move can play in.
+     * \return Mask of the sub-boards, 0 if the game is finished.
+     */
+    quint16 playableSubBoards() const;
+
+    /*!
+     * \brief legalMoveMask Method returns mask of the legal tiles of the given sub-board.
+     * \param subBoard Sub-board index.
+     * \return Mask of the tiles, 0 if the sub-board can not be played.
+     */
+    quint16 legalMoveMask(int subBoard) const;
+
+    /*!
+     * \brief isLegalMove Method checks if the player to move can place the tile in the cell.
+     * \param cell Cell index.
+     * \return True if the move is legal, False otherwise.
+     */
+    bool isLegalMove(int cell) const;
+
+    /*!
+     * \brief legalMoves Method lists all legal moves.
+     * \param cells Output array for at least KNumberOfTiles cell indexes.
+     * \return Number of legal moves.
+     */
+    int legalMoves(int* cells) const;
+
+    /*!
+     * \brief tileState Method returns state of the cell.
+     * \param cell Cell index.
+     * \return Tile state.
+     */
+    ETileState tileState(int cell) const;
+
+    /*!
+     * \brief subBoardTiles Method returns tiles of the player in the sub-board.
+     * \param player Player type.
+     * \param subBoard Sub-board index.
+     * \return Mask of the tiles.
+     */
+    quint16 subBoardTiles(EPlayerType player, int subBoard) const;
+
+    /*!
+     * \brief wonSubBoards Method returns the meta-board mask of the sub-boards won by the player.
+     * \param player Player type.
+     * \return Mask of the sub-boards.
+     */
+    quint16 wonSubBoards(EPlayerType player) const;
+
+    /*!
+     * \brief makeMove Method places the tile of the player to move in the cell. The move must be legal.
+     * \param cell Cell index.
+     * \return Information needed to undo the move.
+     */
+    UndoInfo makeMove(int cell);
+
+    /*!
+     * \brief undoMove Method reverts the last move.
+     * \param cell Cell index of the last move.
+     * \param undoInfo Information returned by makeMove.
+     */
+    void undoMove(int cell, const UndoInfo& undoInfo);
+
+private:
+    quint16 m_tiles[2][KNumberOfSubBoards]; /*!< Tiles of each player per sub-board, indexed by EPlayerType. */
+    quint16 m_wonSubBoards[2]; /*!< Meta-board masks of the sub-boards won by each player. */
+    quint16 m_closedSubBoards; /*!< Mask of the sub-boards which are won or full. */
+    qint8 m_targetSubBoard; /*!< Sub-board the player to move was sent to, or KAnySubBoard. */
+    quint8 m_sideToMove; /*!< Player to move. */
+    quint8 m_roundStatus; /*!< Status of the game. */
+};
+
+#endif // ULTIMATEBOARD_H
@@ -0,0 +1,90 @@
+#include "ultimateengine.h"
+
+UltimateEngine::UltimateEngine(QObject *parent) : GameEngine(parent)
+{
+    m_board.reset(m_currentPlayer);
+}
+
+void UltimateEngine::updateTileState(int index)
+{
+    int cell = UltimateBoard::tileToCell(index);
+
+    if (m_roundStatus == ERoundStatus::NotFinished && m_board.isLegalMove(cell))
+    {
+        m_board.makeMove(cell);
+
+        emit tileStateChanged(index);
+        processTileStateChange(index);
+    }
+}
+
+int UltimateEngine::getTileType(int index) const
+{
+    int cell = UltimateBoard::tileToCell(index);
+    if (cell < 0)
+    {
+        return ETileState::Empty;
+    }
+
+    return m_board.tileState(cell);
+}
+
+bool UltimateEngine::isTilePlayable(int index) const
+{
+    return m_board.isLegalMove(UltimateBoard::tileToCell(index));
+}
+
+int UltimateEngine::getBoardSize() const
+{
+    return UltimateBoard::KBoardSize;
+}
+
+const UltimateBoard& UltimateEngine::board() const
+{
+    return m_board;
+}
+
+void UltimateEngine::resetRoundParameters()
+{
+    GameEngine::resetRoundParameters();
+    m_board.reset(m_currentPlayer);
+}
+
+void UltimateEngine::checkForRoundCompletion(int lastIndex)
+{
+    m_roundStatus = m_board.roundStatus();
+
+    if (m_roundStatus != ERoundStatus::FinishedWin)
+    {
+        return;
+    }
+
+    // Report completed lines of the meta-board going through the sub-board of the last move.
+    quint16 wonSubBoards = m_board.wonSubBoards(m_currentPlayer);
+    int subBoard = UltimateBoard::tileToCell(lastIndex) / UltimateBoard::KNumberOfSubBoards;
+    int row = subBoard / UltimateBoard::KSubBoardSize;
+    int column = subBoard % UltimateBoard::KSubBoardSize;
+    int middle = UltimateBoard::KSubBoardSize / 2;
+
+    quint16 rowMask = static_cast<quint16>(0x007 << (row * UltimateBoard::KSubBoardSize));
+    quint16 columnMask = static_cast<quint16>(0x049 << column);
+    quint16 downDiagonalMask = 0x111;
+    quint16 upDiagonalMask = 0x054;
+
+    if ((wonSubBoards & rowMask) == rowMask)
+    {
+        emit lineCompleted(HorizontalLine, row * UltimateBoard::KSubBoardSize + middle);
+    }
+    if ((wonSubBoards & columnMask) == columnMask)
+    {
+        emit lineCompleted(VerticalLine, column * UltimateBoard::KSubBoardSize + middle);
+    }
+    if (row == column && (wonSubBoards & downDiagonalMask) == downDiagonalMask)
+    {
+        emit lineCompleted(DownDiagonalLine, 0);
+    }
+    if (row + column == UltimateBoard::KSubBoardSize - 1 && (wonSubBoards & upDiagonalMask) == upDiagonalMask)
+    {
+        emit lineCompleted(UpDiagonalLine, 0);
+    }
+}
@@ -0,0 +1,75 @@
+#ifndef ULTIMATEENGINE_H
+#define ULTIMATEENGINE_H
+
+#include "gameengine.h"
+#include "ultimateboard.h"
+
+/*!
+ * \brief The UltimateEngine class Game engine of the ultimate noughts and crosses variant.
+ *
+ * The engine keeps the same tile index protocol as the classic Engine: tiles of the 9x9 board are indexed row by row.
+ * The move determines the sub-board the opponent has to play in next, so only tiles reported by isTilePlayable
+ * are accepted. The round is won by completing a line of won sub-boards, completed lines of the meta-board
+ * are reported with lineCompleted using the index of the middle row or column of the sub-boards.
+ * There is no tablebase of this variant, position queries keep the GameEngine defaults.
+ */
+class UltimateEngine : public GameEngine
+{
+    Q_OBJECT
+
+public:
+    /*!
+     * \brief UltimateEngine Constructor.
+     * \param parent Parent QObject.
+     */
+    UltimateEngine(QObject* parent = nullptr);
+
+    /*!
+     * \brief updateTileState Method places the current player's tile if the move is legal and checks game round for completion.
+     * \param index Tile index to update state for.
+     */
+    void updateTileState(int index) override;
+
+    /*!
+     * \brief getTileType Method returns the type of the given tile.
+     * \param index Tile index to return state for.
+     * \return State of the tile.
+     */
+    int getTileType(int index) const override;
+
+    /*!
+     * \brief isTilePlayable Method checks if the tile is empty and belongs to the sub-board the current player can play in.
+     * \param index Tile index to be checked.
+     * \return True if the tile can be updated, False otherwise.
+     */
+    bool isTilePlayable(int index) const override;
+
+    /*!
+     * \brief getBoardSize Method returns number of tiles in a row of the whole board.
+     * \return Game board size.
+     */
+    int getBoardSize() const override;
+
+    /*!
+     * \brief board Getter method returning current board state, e.g. as a starting point of the search.
+     * \return Board state.
+     */
+    const UltimateBoard& board() const;
+
+protected:
+    /*!
+     * \brief resetRoundParameters Method clears the board before the next round.
+     */
+    void resetRoundParameters() override;
+
+    /*!
+     * \brief checkForRoundCompletion Method takes round status from the board and reports completed lines of the meta-board.
+     * \param lastIndex Tile index which has been recently updated.
+     */
+    void checkForRoundCompletion(int lastIndex) override;
+
+private:
+    UltimateBoard m_board; /*!< Board state. */
+};
+
+#endif // ULTIMATEENGINE_H
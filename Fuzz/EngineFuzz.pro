@@ -0,0 +1,35 @@
+# Randomized checker of the game engine against a brute-force reference.
+# Standalone driver: qmake Fuzz/EngineFuzz.pro && make && ./EngineFuzz [--exhaustive]
+# libFuzzer target (clang): qmake CONFIG+=libfuzzer Fuzz/EngineFuzz.pro && make && ./EngineFuzz
+TEMPLATE = app
+TARGET = EngineFuzz
+
+QT = core
+CONFIG += console c++11
+CONFIG -= app_bundle
+
+INCLUDEPATH += ..
+
+SOURCES += main.cpp \
+    enginefuzzer.cpp \
+    ../Engine/boardgeometry.cpp \
+    ../Engine/engine.cpp \
+    ../Engine/gameengine.cpp \
+    ../Engine/score.cpp \
+    ../Engine/tablebase.cpp \
+    ../Engine/threatindex.cpp
+
+HEADERS += \
+    enginefuzzer.h \
+    ../Engine/boardgeometry.h \
+    ../Engine/engine.h \
+    ../Engine/gameengine.h \
+    ../Engine/score.h \
+    ../Engine/tablebase.h \
+    ../Engine/threatindex.h
+
+libfuzzer {
+    DEFINES += ENGINE_FUZZ_LIBFUZZER
+    QMAKE_CXXFLAGS += -fsanitize=fuzzer,address,undefined
+    QMAKE_LFLAGS += -fsanitize=fuzzer,address,undefined
+}
@@ -0,0 +1,261 @@
+#include "enginefuzzer.h"
+
+#include <QtAlgorithms>
+#include <climits>
+
+namespace {
+
+const int KFarIndexes[] = { INT_MIN, -65536, -1000, -100, -10, -4, Engine::KNumberOfTiles + 3, 100, 1000, 65536, INT_MAX };
+const int KNumberOfFarIndexes = sizeof(KFarIndexes) / sizeof(KFarIndexes[0]);
+const int KNearIndexMargin = 3; // Number of indexes tried before the first and after the last tile.
+
+}
+
+EngineFuzzer::EngineFuzzer() :
+    m_tiles(Engine::KNumberOfTiles, Empty),
+    m_currentPlayer(PlayerX),
+    m_roundStatus(NotFinished),
+    m_draws(0),
+    m_step(0)
+{
+    m_wins[PlayerO] = 0;
+    m_wins[PlayerX] = 0;
+
+    QObject::connect(&m_engine, &Engine::tileStateChanged, [this](int index) { m_record.changedTiles.append(index); });
+    QObject::connect(&m_engine, &Engine::lineCompleted, [this](int lineType, int index) { m_record.completedLines.append(qMakePair(lineType, index)); });
+    QObject::connect(&m_engine, &Engine::roundStatusChanged, [this]() { m_record.roundStatusChanges++; });
+    QObject::connect(&m_engine, &Engine::currentPlayerChanged, [this]() { m_record.currentPlayerChanges++; });
+}
+
+bool EngineFuzzer::playMove(int index)
+{
+    m_step++;
+    m_record = SignalRecord();
+    SignalRecord expected;
+
+    bool valid = m_roundStatus == NotFinished && index >= 0 && index < Engine::KNumberOfTiles && m_tiles.at(index) == Empty;
+    if (valid)
+    {
+        int tileType = m_currentPlayer == PlayerX ? Cross : Nought;
+        m_tiles[index] = tileType;
+        expected.changedTiles.append(index);
+        expected.completedLines = completedLines(m_tiles, tileType);
+
+        if (!expected.completedLines.isEmpty())
+        {
+            m_roundStatus = FinishedWin;
+            m_wins[m_currentPlayer]++;
+        }
+        else if (!m_tiles.contains(Empty))
+        {
+            m_roundStatus = FinishedDraw;
+            m_draws++;
+        }
+
+        if (m_roundStatus == NotFinished)
+        {
+            m_currentPlayer = m_currentPlayer == PlayerX ? PlayerO : PlayerX;
+            expected.currentPlayerChanges = 1;
+        }
+        else
+        {
+            expected.roundStatusChanges = 1;
+        }
+    }
+
+    m_engine.updateTileState(index);
+
+    if (!checkSignals(expected))
+    {
+        return false;
+    }
+
+    return checkState();
+}
+
+bool EngineFuzzer::startNextRound()
+{
+    m_step++;
+    m_record = SignalRecord();
+
+    m_tiles.fill(Empty);
+    m_currentPlayer = m_currentPlayer == PlayerX ? PlayerO : PlayerX;
+    m_roundStatus = NotFinished;
+
+    SignalRecord expected;
+    expected.roundStatusChanges = 1;
+    expected.currentPlayerChanges = 1;
+
+    m_engine.startNextRound();
+
+    if (!checkSignals(expected))
+    {
+        return false;
+    }
+
+    return checkState();
+}
+
+bool EngineFuzzer::playBytes(const quint8* data, size_t size)
+{
+    int nearIndexes = Engine::KNumberOfTiles + 2 * KNearIndexMargin;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        bool matched = true;
+
+        if (data[i] == 0xFF)
+        {
+            matched = startNextRound();
+        }
+        else if (data[i] >= 0xF0)
+        {
+            matched = playMove(KFarIndexes[(data[i] - 0xF0) % KNumberOfFarIndexes]);
+        }
+        else
+        {
+            matched = playMove(data[i] % nearIndexes - KNearIndexMargin);
+        }
+
+        if (!matched)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+QString EngineFuzzer::failure() const
+{
+    return m_failure;
+}
+
+int EngineFuzzer::finishedRounds() const
+{
+    return m_wins[PlayerO] + m_wins[PlayerX] + m_draws;
+}
+
+QVector<QPair<int, int>> EngineFuzzer::completedLines(const QVector<int>& tiles, int tileType)
+{
+    const int boardSize = Engine::KBoardSize;
+    QVector<QPair<int, int>> lines;
+
+    for (int row = 0; row < boardSize; row++)
+    {
+        bool completed = true;
+        for (int column = 0; column < boardSize; column++)
+        {
+            completed = completed && tiles.at(row * boardSize + column) == tileType;
+        }
+        if (completed)
+        {
+            lines.append(qMakePair(static_cast<int>(HorizontalLine), row));
+        }
+    }
+
+    for (int column = 0; column < boardSize; column++)
+    {
+        bool completed = true;
+        for (int row = 0; row < boardSize; row++)
+        {
+            completed = completed && tiles.at(row * boardSize + column) == tileType;
+        }
+        if (completed)
+        {
+            lines.append(qMakePair(static_cast<int>(VerticalLine), column));
+        }
+    }
+
+    bool downDiagonal = true;
+    bool upDiagonal = true;
+    for (int row = 0; row < boardSize; row++)
+    {
+        downDiagonal = downDiagonal && tiles.at(row * boardSize + row) == tileType;
+        upDiagonal = upDiagonal && tiles.at(row * boardSize + boardSize - 1 - row) == tileType;
+    }
+    if (downDiagonal)
+    {
+        lines.append(qMakePair(static_cast<int>(DownDiagonalLine), 0));
+    }
+    if (upDiagonal)
+    {
+        lines.append(qMakePair(static_cast<int>(UpDiagonalLine), 0));
+    }
+
+    return lines;
+}
+
+bool EngineFuzzer::checkSignals(const SignalRecord& expected)
+{
+    if (m_record.changedTiles != expected.changedTiles)
+    {
+        return fail(QString("tileStateChanged emitted %1 times, expected %2").arg(m_record.changedTiles.size()).arg(expected.changedTiles.size()));
+    }
+
+    QVector<QPair<int, int>> recordedLines = m_record.completedLines;
+    QVector<QPair<int, int>> expectedLines = expected.completedLines;
+    std::sort(recordedLines.begin(), recordedLines.end());
+    std::sort(expectedLines.begin(), expectedLines.end());
+    if (recordedLines != expectedLines)
+    {
+        return fail(QString("lineCompleted emitted for %1 lines, expected %2").arg(recordedLines.size()).arg(expectedLines.size()));
+    }
+
+    if (m_record.roundStatusChanges != expected.roundStatusChanges)
+    {
+        return fail(QString("roundStatusChanged emitted %1 times, expected %2").arg(m_record.roundStatusChanges).arg(expected.roundStatusChanges));
+    }
+
+    if (m_record.currentPlayerChanges != expected.currentPlayerChanges)
+    {
+        return fail(QString("currentPlayerChanged emitted %1 times, expected %2").arg(m_record.currentPlayerChanges).arg(expected.currentPlayerChanges));
+    }
+
+    return true;
+}
+
+bool EngineFuzzer::checkState()
+{
+    for (int index = -KNearIndexMargin; index < Engine::KNumberOfTiles + KNearIndexMargin; index++)
+    {
+        bool onBoard = index >= 0 && index < Engine::KNumberOfTiles;
+        int expectedType = onBoard ? m_tiles.at(index) : static_cast<int>(Empty);
+
+        if (m_engine.getTileType(index) != expectedType)
+        {
+            return fail(QString("tile %1 is %2, expected %3").arg(index).arg(m_engine.getTileType(index)).arg(expectedType));
+        }
+        if (m_engine.isTilePlayable(index) != (m_roundStatus == NotFinished && onBoard && expectedType == Empty))
+        {
+            return fail(QString("tile %1 playability differs").arg(index));
+        }
+    }
+
+    if (m_engine.getRoundStatus() != m_roundStatus)
+    {
+        return fail(QString("round status is %1, expected %2").arg(m_engine.getRoundStatus()).arg(m_roundStatus));
+    }
+
+    if (m_engine.getCurrentPlayer() != m_currentPlayer)
+    {
+        return fail(QString("current player is %1, expected %2").arg(m_engine.getCurrentPlayer()).arg(m_currentPlayer));
+    }
+
+    if (m_engine.getWinsNumberForCurrentPlayer() != m_wins[m_currentPlayer] || m_engine.getDrawsNumberForCurrentPlayer() != m_draws)
+    {
+        return fail(QString("score of the current player differs"));
+    }
+
+    return true;
+}
+
+bool EngineFuzzer::fail(const QString& description)
+{
+    if (m_failure.isEmpty())
+    {
+        m_failure = QString("step %1: %2").arg(m_step).arg(description);
+    }
+
+    return false;
+}
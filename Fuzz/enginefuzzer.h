@@ -0,0 +1,112 @@
+#ifndef ENGINEFUZZER_H
+#define ENGINEFUZZER_H
+
+#include <QPair>
+#include <QString>
+#include <QVector>
+
+#include "Engine/engine.h"
+
+/*!
+ * \brief The EngineFuzzer class Plays actions through the Engine and checks every step against an independent reference.
+ *
+ * The reference keeps its own board and finds completed lines by brute force over all rows, columns and diagonals.
+ * Signals of the engine are recorded during each action and compared with what the reference expects: tile changes,
+ * completed lines, round status and current player notifications, as well as the whole visible engine state afterwards.
+ * Invalid actions (tiles out of the board, occupied tiles, moves after the end of the round) must change nothing.
+ */
+class EngineFuzzer
+{
+public:
+    /*!
+     * \brief The SignalRecord struct Signals emitted by the engine during a single action.
+     */
+    struct SignalRecord
+    {
+        QVector<int> changedTiles; /*!< Arguments of tileStateChanged. */
+        QVector<QPair<int, int>> completedLines; /*!< Arguments of lineCompleted (line type, index). */
+        int roundStatusChanges = 0; /*!< Number of roundStatusChanged signals. */
+        int currentPlayerChanges = 0; /*!< Number of currentPlayerChanged signals. */
+    };
+
+    /*!
+     * \brief EngineFuzzer Constructor creating engine and reference at the start of the first round.
+     */
+    EngineFuzzer();
+
+    /*!
+     * \brief playMove Method places the tile in the engine and checks the outcome.
+     * \param index Tile index, may be out of the board.
+     * \return True if the engine behaved like the reference, False otherwise.
+     */
+    bool playMove(int index);
+
+    /*!
+     * \brief startNextRound Method starts the next round in the engine and checks the outcome.
+     * \return True if the engine behaved like the reference, False otherwise.
+     */
+    bool startNextRound();
+
+    /*!
+     * \brief playBytes Method decodes the bytes into actions and plays them until the first mismatch.
+     * Byte 0xFF starts the next round, bytes 0xF0-0xFE play tiles far out of the board,
+     * other bytes play tiles from just before the first tile to just after the last one.
+     * \param data Bytes to decode.
+     * \param size Number of bytes.
+     * \return True if the engine behaved like the reference, False otherwise.
+     */
+    bool playBytes(const quint8* data, size_t size);
+
+    /*!
+     * \brief failure Getter method returning description of the first mismatch.
+     * \return Description, empty if there has been no mismatch.
+     */
+    QString failure() const;
+
+    /*!
+     * \brief finishedRounds Getter method returning number of rounds finished with a win or a draw so far.
+     * \return Number of finished rounds.
+     */
+    int finishedRounds() const;
+
+    /*!
+     * \brief completedLines Function finds all lines of the board filled with the given tile type by brute force.
+     * \param tiles ETileState of each tile.
+     * \param tileType Tile type to look for.
+     * \return Completed lines as (ELineType, index) pairs in the order of lineCompleted arguments.
+     */
+    static QVector<QPair<int, int>> completedLines(const QVector<int>& tiles, int tileType);
+
+private:
+    Engine m_engine; /*!< Engine under test. */
+    SignalRecord m_record; /*!< Signals of the current action. */
+    QVector<int> m_tiles; /*!< Reference tile states. */
+    EPlayerType m_currentPlayer; /*!< Reference current player. */
+    ERoundStatus m_roundStatus; /*!< Reference round status. */
+    int m_wins[2]; /*!< Reference wins of each player. */
+    int m_draws; /*!< Reference number of draws. */
+    int m_step; /*!< Number of played actions. */
+    QString m_failure; /*!< Description of the first mismatch. */
+
+    /*!
+     * \brief checkSignals Method compares recorded signals with the expected ones.
+     * \param expected Signals expected by the reference.
+     * \return True if the signals match, False otherwise.
+     */
+    bool checkSignals(const SignalRecord& expected);
+
+    /*!
+     * \brief checkState Method compares the engine state visible through its public methods with the reference.
+     * \return True if the state matches, False otherwise.
+     */
+    bool checkState();
+
+    /*!
+     * \brief fail Method records the first mismatch.
+     * \param description Description of the mismatch.
+     * \return Always False.
+     */
+    bool fail(const QString& description);
+};
+
+#endif // ENGINEFUZZER_H
@@ -0,0 +1,201 @@
+#include "enginefuzzer.h"
+
+#ifdef ENGINE_FUZZ_LIBFUZZER
+
+#include <cstdint>
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size)
+{
+    // A fresh engine for every input keeps crashes reproducible from the input alone.
+    EngineFuzzer fuzzer;
+    if (!fuzzer.playBytes(data, size))
+    {
+        qFatal("%s", qPrintable(fuzzer.failure()));
+    }
+
+    return 0;
+}
+
+#else
+
+#include <QCommandLineParser>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QStringList>
+#include <climits>
+
+namespace {
+
+const int KOutOfBoardIndexes[] = { -1, Engine::KNumberOfTiles, INT_MIN, INT_MAX };
+
+/*!
+ * \brief replayGame Function plays the game with invalid moves injected at every step, then tries to play after its end.
+ * \param fuzzer Fuzzer reused between the games, the game is played in a new round.
+ * \param moves Valid moves of the game.
+ * \param failure Description of the mismatch, set on failure.
+ * \return True if the engine matched the reference, False otherwise.
+ */
+bool replayGame(EngineFuzzer& fuzzer, const QVector<int>& moves, QString& failure)
+{
+    bool matched = fuzzer.startNextRound();
+
+    for (int move = 0; move < moves.size() && matched; move++)
+    {
+        // Occupied tile and a tile out of the board before each move.
+        if (move > 0)
+        {
+            matched = fuzzer.playMove(moves.at(move - 1));
+        }
+        matched = matched && fuzzer.playMove(KOutOfBoardIndexes[move % 4]);
+        matched = matched && fuzzer.playMove(moves.at(move));
+    }
+
+    // Every tile after the end of the round.
+    for (int index = 0; index < Engine::KNumberOfTiles && matched; index++)
+    {
+        matched = fuzzer.playMove(index);
+    }
+
+    if (!matched)
+    {
+        QStringList playedMoves;
+        for (int move : moves)
+        {
+            playedMoves.append(QString::number(move));
+        }
+
+        failure = QString("game %1: %2").arg(playedMoves.join(' ')).arg(fuzzer.failure());
+    }
+
+    return matched;
+}
+
+/*!
+ * \brief playAllGames Function enumerates every possible game and replays each of them.
+ * \param fuzzer Fuzzer replaying the games.
+ * \param tiles Tiles of the enumerated position.
+ * \param moves Moves leading to the position.
+ * \param games Number of replayed games.
+ * \param failure Description of the mismatch, set on failure.
+ * \return True if the engine matched the reference in all games, False otherwise.
+ */
+bool playAllGames(EngineFuzzer& fuzzer, QVector<int>& tiles, QVector<int>& moves, int& games, QString& failure)
+{
+    int tileType = moves.size() % 2 == 0 ? Cross : Nought;
+
+    for (int index = 0; index < Engine::KNumberOfTiles; index++)
+    {
+        if (tiles.at(index) != Empty)
+        {
+            continue;
+        }
+
+        tiles[index] = tileType;
+        moves.append(index);
+
+        bool matched = true;
+        if (!EngineFuzzer::completedLines(tiles, tileType).isEmpty() || moves.size() == Engine::KNumberOfTiles)
+        {
+            games++;
+            matched = replayGame(fuzzer, moves, failure);
+        }
+        else
+        {
+            matched = playAllGames(fuzzer, tiles, moves, games, failure);
+        }
+
+        moves.removeLast();
+        tiles[index] = Empty;
+
+        if (!matched)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption gamesOption("games", "Number of random action sequences.", "games", "100000");
+    QCommandLineOption lengthOption("length", "Number of actions in each random sequence.", "length", "64");
+    QCommandLineOption seedOption("seed", "Seed of the random sequences.", "seed", "2463534242");
+    QCommandLineOption exhaustiveOption("exhaustive", "Also replay every possible game with invalid moves injected at each step.");
+    parser.addOptions({ gamesOption, lengthOption, seedOption, exhaustiveOption });
+    parser.process(app);
+
+    // One engine serves all the games, each of them starts with startNextRound, so no engine is constructed per game.
+    EngineFuzzer fuzzer;
+    QElapsedTimer timer;
+
+    if (parser.isSet(exhaustiveOption))
+    {
+        QVector<int> tiles(Engine::KNumberOfTiles, Empty);
+        QVector<int> moves;
+        QString failure;
+        int games = 0;
+
+        timer.start();
+        if (!playAllGames(fuzzer, tiles, moves, games, failure))
+        {
+            qWarning("%s", qPrintable(failure));
+            return 1;
+        }
+
+        double seconds = qMax<qint64>(1, timer.elapsed()) / 1000.0;
+        qInfo("Replayed %d games in %.2f s (%.0f games/s).", games, seconds, games / seconds);
+    }
+
+    int sequences = parser.value(gamesOption).toInt();
+    QVector<quint8> data(qMax(1, parser.value(lengthOption).toInt()));
+    quint32 random = parser.value(seedOption).toUInt();
+    if (random == 0)
+    {
+        random = 1;
+    }
+
+    int roundsBefore = fuzzer.finishedRounds();
+    timer.start();
+
+    for (int sequence = 0; sequence < sequences; sequence++)
+    {
+        for (quint8& byte : data)
+        {
+            random ^= random << 13;
+            random ^= random >> 17;
+            random ^= random << 5;
+
+            // Start the next round now and then, so most of the actions are played during a round.
+            byte = random % 16 == 0 ? 0xFF : static_cast<quint8>(random >> 8);
+        }
+
+        if (!fuzzer.startNextRound() || !fuzzer.playBytes(data.constData(), static_cast<size_t>(data.size())))
+        {
+            QStringList bytes;
+            for (quint8 byte : data)
+            {
+                bytes.append(QString::number(byte, 16));
+            }
+
+            // The engine carries scores and the starting player over from the previous sequences, rerun with the same seed to reproduce.
+            qWarning("Seed %s, sequence %d (%s): %s", qPrintable(parser.value(seedOption)), sequence, qPrintable(bytes.join(' ')), qPrintable(fuzzer.failure()));
+            return 1;
+        }
+    }
+
+    double seconds = qMax<qint64>(1, timer.elapsed()) / 1000.0;
+    int rounds = fuzzer.finishedRounds() - roundsBefore;
+    qInfo("Played %d random sequences of %d actions in %.2f s (%.0f actions/s), %d rounds finished (%.0f games/s).",
+          sequences, data.size(), seconds, sequences * static_cast<double>(data.size()) / seconds, rounds, rounds / seconds);
+
+    return 0;
+}
+
+#endif
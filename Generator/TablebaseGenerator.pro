@@ -0,0 +1,20 @@
+# Console tool generating tablebases for the game, it does not need a display.
+# qmake Generator/TablebaseGenerator.pro && make && ./TablebaseGenerator tablebase.bin
+TEMPLATE = app
+TARGET = TablebaseGenerator
+
+QT = core
+CONFIG += console c++11
+CONFIG -= app_bundle
+
+INCLUDEPATH += ..
+
+SOURCES += main.cpp \
+    ../Engine/boardgeometry.cpp \
+    ../Engine/tablebase.cpp \
+    ../Engine/tablebasegenerator.cpp
+
+HEADERS += \
+    ../Engine/boardgeometry.h \
+    ../Engine/tablebase.h \
+    ../Engine/tablebasegenerator.h
@@ -0,0 +1,38 @@
+#include <QCommandLineParser>
+#include <QCoreApplication>
+
+#include "Engine/engine.h"
+#include "Engine/tablebasegenerator.h"
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("Generates tablebase of solved positions. "
+                                     "The game accepts only tablebases of its own 3x3 board with full line wins, which are the defaults.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("file", "Path to the generated tablebase.");
+    QCommandLineOption sizeOption("board-size", "Board size of the generated tablebase, up to 4.", "size", QString::number(Engine::KBoardSize));
+    QCommandLineOption lineOption("line-length", "Winning line length of the generated tablebase.", "length", QString::number(Engine::KBoardSize));
+    QCommandLineOption threadsOption("threads", "Number of threads used for generation, 0 for the number of cores.", "threads", "0");
+    parser.addOptions({ sizeOption, lineOption, threadsOption });
+    parser.process(app);
+
+    if (parser.positionalArguments().size() != 1)
+    {
+        parser.showHelp(1);
+    }
+
+    QString filePath = parser.positionalArguments().first();
+    TablebaseGenerator generator(parser.value(sizeOption).toInt(), parser.value(lineOption).toInt(), parser.value(threadsOption).toInt());
+    if (!generator.generate(filePath))
+    {
+        qWarning("Tablebase %s could not be written.", qPrintable(filePath));
+        return 1;
+    }
+
+    qInfo("Wrote %u positions to %s.", generator.numberOfEntries(), qPrintable(filePath));
+
+    return 0;
+}
@@ -5,8 +5,17 @@ CONFIG += c++11
 
 SOURCES += main.cpp \
     Controller/controller.cpp \
+    Controller/spectatorfeed.cpp \
+    Controller/spectatormodel.cpp \
+    Engine/boardgeometry.cpp \
     Engine/engine.cpp \
-    Engine/score.cpp
+    Engine/gameengine.cpp \
+    Engine/moveanalyzer.cpp \
+    Engine/score.cpp \
+    Engine/tablebase.cpp \
+    Engine/threatindex.cpp \
+    Engine/ultimateboard.cpp \
+    Engine/ultimateengine.cpp
 
 RESOURCES += qml.qrc
 
@@ -34,5 +43,14 @@ else: unix:!android: target.path = /opt/$${TARGET}/bin
 
 HEADERS += \
     Controller/controller.h \
+    Controller/spectatorfeed.h \
+    Controller/spectatormodel.h \
+    Engine/boardgeometry.h \
     Engine/engine.h \
-    Engine/score.h
+    Engine/gameengine.h \
+    Engine/moveanalyzer.h \
+    Engine/score.h \
+    Engine/tablebase.h \
+    Engine/threatindex.h \
+    Engine/ultimateboard.h \
+    Engine/ultimateengine.h
@@ -0,0 +1,71 @@
+import QtQuick 2.8
+import QtQuick.Window 2.2
+import enums 1.0
+
+
+// Spectator window showing a grid of live boards.
+Window {
+    id: spectatorWindow
+    visible: true
+    width: 1280
+    height: 720
+    title: qsTr("Naughts and Crosses - spectator")
+
+    readonly property int boardSpacing: 8
+    readonly property int minimumBoardSize: 160
+    readonly property string crossImage: "qrc:/Images/cross.png"
+    readonly property string noughtImage: "qrc:/Images/nought.png"
+
+    GridView {
+        id: boardsGrid
+        anchors.fill: parent
+        anchors.margins: boardSpacing
+        clip: true
+        model: spectatorModel
+        // Only delegates of boards on the screen are created, the others are not updated at all.
+        cacheBuffer: 0
+
+        readonly property int columns: Math.max(1, Math.floor(width / minimumBoardSize))
+        cellWidth: Math.floor(width / columns)
+        cellHeight: cellWidth
+
+        delegate: Rectangle {
+            id: boardRectangle
+            width: boardsGrid.cellWidth - boardSpacing
+            height: boardsGrid.cellHeight - boardSpacing
+            color: roundStatus === Enums.FinishedWin ? "lightgreen" :
+                   roundStatus === Enums.FinishedDraw ? "lightgray" : "black"
+
+            property int boardIndex: index
+            property var boardTiles: tiles
+            property int tileSize: (width - (boardSize + 1) * 2) / boardSize
+
+            Component.onCompleted: spectatorModel.setBoardVisible(boardIndex, true)
+            Component.onDestruction: spectatorModel.setBoardVisible(boardIndex, false)
+
+            Grid {
+                anchors.centerIn: parent
+                columns: boardSize
+                spacing: 2
+
+                Repeater {
+                    model: boardSize * boardSize
+
+                    Rectangle {
+                        width: boardRectangle.tileSize
+                        height: boardRectangle.tileSize
+                        color: "white"
+
+                        Image {
+                            anchors.fill: parent
+                            sourceSize.width: width
+                            sourceSize.height: height
+                            visible: boardRectangle.boardTiles[index] !== Enums.Empty
+                            source: boardRectangle.boardTiles[index] === Enums.Cross ? crossImage : noughtImage
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
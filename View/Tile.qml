@@ -1,9 +1,14 @@
 import QtQuick 2.8
+import enums 1.0
 
 // Class representing tile on the board.
 Rectangle {
     property alias fronSideZ: frontSide.z
     property alias imageSource: image.source
+    property bool playable: true
+    property int moveValue: Enums.UnknownPosition
+    property int moveDistance: 0
+    property bool hinted: false
 
     Image {
         id: image
@@ -13,6 +18,25 @@ Rectangle {
     Rectangle {
         id: frontSide
         anchors.fill: parent
-        color: "white"
+        color: playable ? "white" : "lightgray"
+        // Best move according to the tablebase.
+        border.color: "royalblue"
+        border.width: hinted ? 4 : 0
+    }
+
+    // Evaluation of the move to this tile for the current player.
+    Rectangle {
+        id: evaluationOverlay
+        anchors.fill: parent
+        visible: playable && moveValue !== Enums.UnknownPosition
+        color: moveValue === Enums.WinningPosition ? "green" :
+               moveValue === Enums.LosingPosition ? "red" : "gold"
+        opacity: 0.4
+
+        Text {
+            anchors.centerIn: parent
+            text: moveDistance
+            font.pixelSize: 24
+        }
     }
 }
@@ -55,6 +55,7 @@ Window {
                         Layout.fillWidth: true
                         property alias angleAnimation: onAngle
                         property alias angleValue: rotation.angle
+                        hinted: controller.bestMove === index
 
                         transform: Rotation {
                             id: rotation;
@@ -87,6 +88,9 @@ Window {
                             target: controller
                             onTileStateChanged: {
 
+                            // Playable tiles depend on the last move in the ultimate variant.
+                            tileRectangle.playable = controller.isTilePlayable(index)
+
                             // Update corresponding tile with the current player's symbol.
                             if (index == tileIndex) {
                                     var tileType = controller.getTileType(index)
@@ -101,13 +105,22 @@ Window {
                                     }
                                 }
                             }
+
+                            onRoundStatusChanged: {
+                                tileRectangle.playable = controller.isTilePlayable(index)
+                            }
+
+                            onMoveEvaluationsChanged: {
+                                tileRectangle.moveValue = controller.getMoveValue(index)
+                                tileRectangle.moveDistance = controller.getMoveDistance(index)
+                            }
                         }
 
                         MouseArea {
                             enabled: controller.roundStatus === Enums.NotFinished
                             anchors.fill: parent;
                             onClicked: {
-                                if (controller.getTileType(index) === Enums.Empty) {
+                                if (controller.isTilePlayable(index)) {
                                     controller.updateTileState(index)
                                 }
                             }
@@ -145,7 +158,7 @@ Window {
                 anchors.leftMargin: - 0.1 * boardPane.width
                 anchors.rightMargin: - 0.1 * boardPane.width
                 height: mainWindow.crossLineHeight
-                y: gridLayout.totalTileHeight + gridLayout.halfTileHeight
+                y: (boardPane.height - height) / 2
 
                 transform: Rotation {
                     origin.x: downDiagonalCorssLine.width / 2
@@ -162,7 +175,7 @@ Window {
                 anchors.leftMargin: - 0.1 * boardPane.width
                 anchors.rightMargin: - 0.1 * boardPane.width
                 height: mainWindow.crossLineHeight
-                y: gridLayout.totalTileHeight + gridLayout.halfTileHeight
+                y: (boardPane.height - height) / 2
 
                 transform: Rotation {
                     origin.x: downDiagonalCorssLine.width / 2
@@ -272,6 +285,18 @@ Window {
                 numberOfWins: controller.winsNumber
                 numberOfDraws: controller.drawsNumber
             }
+
+            // Outcome of the round with perfect play, available when the tablebase is loaded.
+            Text {
+                id: positionValueLabel
+                anchors.horizontalCenter: parent.horizontalCenter
+                anchors.top: scorePlayerPane.bottom
+                anchors.topMargin: 10
+                visible: controller.positionValue !== Enums.UnknownPosition
+                text: controller.positionValue === Enums.WinningPosition ? "Winning in " + controller.positionDistance :
+                      controller.positionValue === Enums.LosingPosition ? "Losing in " + controller.positionDistance : "Drawn"
+                font.pixelSize: 16
+            }
         }
     }
 
@@ -1,19 +1,29 @@
+#include <QCommandLineParser>
 #include <QGuiApplication>
 #include <QQmlApplicationEngine>
 #include <QQmlContext>
+#include <QQuickWindow>
 
 #include "Controller/controller.h"
+#include "Controller/spectatorfeed.h"
+#include "Controller/spectatormodel.h"
 #include "Engine/engine.h"
+#include "Engine/ultimateengine.h"
 
 int main(int argc, char *argv[])
 {
     QGuiApplication app(argc, argv);
 
-    QQmlApplicationEngine qmlEngine;
-
-    Engine gameEngine;
-    Controller gameController(gameEngine);
-
+    QCommandLineParser parser;
+    parser.addHelpOption();
+    QCommandLineOption ultimateOption("ultimate", "Play ultimate noughts and crosses (3x3 board of 3x3 boards).");
+    QCommandLineOption analysisOption("analysis", "Show evaluation of every empty tile for the current player.");
+    QCommandLineOption tablebaseOption("tablebase", "Load tablebase from <file>, generated with the TablebaseGenerator tool. "
+                                       "The game accepts only tablebases of its own 3x3 board.", "file");
+    QCommandLineOption spectateOption("spectate", "Watch <boards> live games of random moves at once.", "boards");
+    QCommandLineOption spectateRateOption("spectate-rate", "Number of moves per second of each watched game, 0 for no limit.", "moves", "4");
+    parser.addOptions({ ultimateOption, analysisOption, tablebaseOption, spectateOption, spectateRateOption });
+    parser.process(app);
 
     // Make Enums namespace available in QML views.
     qmlRegisterUncreatableMetaObject(
@@ -24,6 +34,47 @@ int main(int argc, char *argv[])
       "Error: only enums"       // error in case of attempt to create a Enums object
     );
 
+    // Spectator objects are declared before the QML engine, so they outlive the delegates using them.
+    QScopedPointer<SpectatorModel> spectatorModel;
+    QScopedPointer<SpectatorFeed> spectatorFeed;
+    QQmlApplicationEngine qmlEngine;
+
+    if (parser.isSet(spectateOption))
+    {
+        int boardsNumber = parser.value(spectateOption).toInt();
+        spectatorModel.reset(new SpectatorModel(boardsNumber, Engine::KBoardSize));
+        spectatorFeed.reset(new SpectatorFeed(*spectatorModel, boardsNumber, parser.value(spectateRateOption).toInt()));
+
+        qmlEngine.rootContext()->setContextProperty("spectatorModel", spectatorModel.data());
+
+        qmlEngine.load(QUrl(QStringLiteral("qrc:/View/SpectatorView.qml")));
+        if (qmlEngine.rootObjects().isEmpty())
+            return -1;
+
+        spectatorModel->setWindow(qobject_cast<QQuickWindow*>(qmlEngine.rootObjects().first()));
+        spectatorFeed->start();
+
+        return app.exec();
+    }
+
+    QScopedPointer<GameEngine> gameEngine;
+    if (parser.isSet(ultimateOption))
+    {
+        gameEngine.reset(new UltimateEngine());
+    }
+    else
+    {
+        gameEngine.reset(new Engine());
+    }
+
+    Controller gameController(*gameEngine);
+    gameController.setAnalysisEnabled(parser.isSet(analysisOption));
+
+    if (parser.isSet(tablebaseOption) && !gameController.loadTablebase(parser.value(tablebaseOption)))
+    {
+        qWarning("Tablebase %s could not be loaded.", qPrintable(parser.value(tablebaseOption)));
+    }
+
     qmlEngine.rootContext()->setContextProperty("controller", &gameController);
 
     qmlEngine.load(QUrl(QStringLiteral("qrc:/View/main.qml")));